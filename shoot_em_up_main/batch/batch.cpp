@@ -0,0 +1,402 @@
+#include <SDL3/SDL_stdinc.h>
+#include <SDL3/SDL_timer.h>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <format>
+#include <fstream>
+#include <string>
+#include <vector>
+#include "world.h"
+#include "input.h"
+#include "random.h"
+#include "jobpool.h"
+#include "seed.h"
+
+// Batch runner: plays many independent worlds (level file x input policy x seed) on every core and writes
+// one row per playthrough to a CSV file, then prints a summary per level and input.
+// Run it from the game folder, the level files are looked up from there.
+
+static const int SCREEN_WIDTH = 1920;      //same virtual screen as the game's headless runs
+static const int SCREEN_HEIGHT = 1080;
+
+enum class PolicyType { Idle, Fire, Sweep, Random, Script };
+
+// How the player is driven during a playthrough
+struct InputPolicy {
+    PolicyType type;
+    std::string name;
+    InputScript script;         // copied by every run, it keeps its own position
+};
+
+enum class Outcome : Uint8 { Victory, GameOver, Timeout };
+
+struct BatchOptions {
+    std::vector<int> levels;
+    std::vector<std::string> levelFiles;
+    std::vector<InputPolicy> policies;
+    int runs;                   // seeds per level and input
+    Uint64 seed;                // run r plays with seed + r
+    Uint64 ticks;               // a playthrough stops after this many ticks at most
+    int tickRate;
+    int threads;                // 0 for one per core
+    std::string outPath;
+};
+
+// Results kept column by column, each run only writes its own row so the workers never share one
+struct BatchColumns {
+    std::vector<int> level;     // index in the level files
+    std::vector<int> policy;    // index in the policies
+    std::vector<Uint64> seed;
+    std::vector<Outcome> outcome;
+    std::vector<int> score;
+    std::vector<int> damageTaken;
+    std::vector<Uint64> ticks;  // ticks survived
+    std::vector<int> enemiesKilled;
+    std::vector<int> enemiesEscaped;
+
+    void resize(size_t count) {
+        level.resize(count);
+        policy.resize(count);
+        seed.resize(count);
+        outcome.resize(count);
+        score.resize(count);
+        damageTaken.resize(count);
+        ticks.resize(count);
+        enemiesKilled.resize(count);
+        enemiesEscaped.resize(count);
+    }
+};
+
+static bool readNumber(const char* text, long long& value) {      //the whole argument has to be a number
+    char* end = nullptr;
+    value = std::strtoll(text, &end, 10);
+    return end != text && *end == '\0';
+}
+
+static void printUsage(const char* program) {
+    printf("usage: %s [--level 1|2]... [--level-file <path>]... [--input idle,fire,sweep,random,script:<path>] [--runs N] [--seed S] [--ticks N] [--tick-rate N] [--threads N] [--out <path>]\n", program);
+}
+
+static bool parsePolicies(const char* value, std::vector<InputPolicy>& policies) {      //comma separated
+    policies.clear();
+    std::string list = value;
+    size_t start = 0;
+    while (start <= list.size()) {
+        size_t end = list.find(',', start);
+        if (end == std::string::npos)
+            end = list.size();
+        std::string name = list.substr(start, end - start);
+        start = end + 1;
+
+        InputPolicy policy = { PolicyType::Idle, name, InputScript() };
+        if (name == "idle")
+            policy.type = PolicyType::Idle;
+        else if (name == "fire")
+            policy.type = PolicyType::Fire;
+        else if (name == "sweep")
+            policy.type = PolicyType::Sweep;
+        else if (name == "random")
+            policy.type = PolicyType::Random;
+        else if (name.rfind("script:", 0) == 0 && name.size() > 7) {
+            policy.type = PolicyType::Script;
+            if (!policy.script.load(name.c_str() + 7))
+                return false;
+        }
+        else {
+            printf("Error: unknown input %s, expected idle, fire, sweep, random or script:<path>\n", name.c_str());
+            return false;
+        }
+        policies.push_back(policy);
+    }
+    return true;
+}
+
+static bool parseOptions(int argc, char* argv[], BatchOptions& options) {
+    for (int i = 1; i < argc; i++) {
+        const char* arg = argv[i];
+        const char* value = i + 1 < argc ? argv[i + 1] : nullptr;
+        long long number = 0;
+
+        if (std::strcmp(arg, "--level") == 0 && value) {
+            if (!readNumber(value, number) || number < 1 || number > 2) {
+                printf("Error: --level expects 1 or 2\n");
+                return false;
+            }
+            options.levels.push_back(static_cast<int>(number));
+            i++;
+        }
+        else if (std::strcmp(arg, "--level-file") == 0 && value) {
+            options.levelFiles.push_back(value);
+            i++;
+        }
+        else if (std::strcmp(arg, "--input") == 0 && value) {
+            if (!parsePolicies(value, options.policies))
+                return false;
+            i++;
+        }
+        else if (std::strcmp(arg, "--runs") == 0 && value) {
+            if (!readNumber(value, number) || number < 1 || number > 10000000) {
+                printf("Error: --runs expects a number between 1 and 10000000\n");
+                return false;
+            }
+            options.runs = static_cast<int>(number);
+            i++;
+        }
+        else if (std::strcmp(arg, "--seed") == 0 && value) {
+            if (!parseSeed(value, options.seed)) {
+                printf("Error: --seed expects a whole number between 0 and 18446744073709551615\n");
+                return false;
+            }
+            i++;
+        }
+        else if (std::strcmp(arg, "--ticks") == 0 && value) {
+            if (!readNumber(value, number) || number < 1) {
+                printf("Error: --ticks expects a positive number\n");
+                return false;
+            }
+            options.ticks = static_cast<Uint64>(number);
+            i++;
+        }
+        else if (std::strcmp(arg, "--tick-rate") == 0 && value) {
+            if (!readNumber(value, number) || number < 1 || number > 1000) {
+                printf("Error: --tick-rate expects a number between 1 and 1000\n");
+                return false;
+            }
+            options.tickRate = static_cast<int>(number);
+            i++;
+        }
+        else if (std::strcmp(arg, "--threads") == 0 && value) {
+            if (!readNumber(value, number) || number < 0 || number > 1024) {
+                printf("Error: --threads expects a number between 0 and 1024\n");
+                return false;
+            }
+            options.threads = static_cast<int>(number);
+            i++;
+        }
+        else if (std::strcmp(arg, "--out") == 0 && value) {
+            options.outPath = value;
+            i++;
+        }
+        else {
+            printf("Error: unknown or incomplete option %s\n", arg);
+            printUsage(argv[0]);
+            return false;
+        }
+    }
+    return true;
+}
+
+// Input of one playthrough, the random policy has its own sequence so it never disturbs the world's
+class PolicyDriver {
+private:
+    const InputPolicy& policy;
+    InputScript script;
+    Random random;
+    InputFrame current;
+    Uint64 nextChange;
+    bool goingRight;
+
+public:
+    PolicyDriver(const InputPolicy& policy, Uint64 seed) : policy(policy), script(policy.script), random(seed ^ 0x632BE59BD9B4E019ull), current{}, nextChange(0), goingRight(true) {
+        current.fire = policy.type != PolicyType::Idle;
+    }
+
+    InputFrame next(const World& world, Uint64 tick) {
+        switch (policy.type) {
+        case PolicyType::Idle:
+        case PolicyType::Fire:
+            break;
+        case PolicyType::Sweep: {       //fire held, from one side of the play area to the other
+            SDL_FRect player = world.getPlayer().getRect();
+            PlayBounds bounds = world.getBounds();
+            if (player.x + player.w >= bounds.x + bounds.width - 1.0f)
+                goingRight = false;
+            else if (player.x <= bounds.x + 1.0f)
+                goingRight = true;
+            current.right = goingRight;
+            current.left = !goingRight;
+            break;
+        }
+        case PolicyType::Random:        //new keys every quarter to one and a quarter second at 60 ticks per second
+            if (tick >= nextChange) {
+                Uint32 horizontal = random.below(3);
+                Uint32 vertical = random.below(4);
+                current.left = horizontal == 1;
+                current.right = horizontal == 2;
+                current.up = vertical == 1;
+                current.down = vertical == 2;
+                current.fire = random.below(4) != 0;
+                nextChange = tick + 15 + random.below(60);
+            }
+            break;
+        case PolicyType::Script:
+            current = script.advance(tick);
+            break;
+        }
+        return current;
+    }
+};
+
+static void playRun(const BatchOptions& options, const PlayBounds& bounds, int row, BatchColumns& results) {
+    const InputPolicy& policy = options.policies[results.policy[row]];
+    World world(bounds);
+    world.setSeed(results.seed[row]);
+    world.loadLevelFile(options.levelFiles[results.level[row]]);
+    PolicyDriver driver(policy, results.seed[row]);
+
+    const float dt = 1.0f / options.tickRate;
+    int health = world.getPlayer().getHealth();
+    int damage = 0;
+    Uint64 tick = 0;
+    Outcome outcome = Outcome::Timeout;
+    while (tick < options.ticks) {
+        world.step(driver.next(world, tick), dt);
+        tick++;
+
+        int now = world.getPlayer().getHealth();
+        if (now < health)
+            damage += health - now;
+        health = now;
+
+        if (world.getState().isVictory()) {
+            outcome = Outcome::Victory;
+            break;
+        }
+        if (world.getState().isGameOver()) {
+            outcome = Outcome::GameOver;
+            break;
+        }
+    }
+
+    results.outcome[row] = outcome;
+    results.score[row] = world.getState().getScore();
+    results.damageTaken[row] = damage;
+    results.ticks[row] = tick;
+    results.enemiesKilled[row] = world.getEnemies().countKilled();
+    results.enemiesEscaped[row] = world.getEnemies().countEscaped();
+}
+
+static const char* outcomeName(Outcome outcome) {
+    return outcome == Outcome::Victory ? "victory" : outcome == Outcome::GameOver ? "game_over" : "timeout";
+}
+
+static bool writeResults(const BatchOptions& options, const BatchColumns& results) {
+    std::ofstream out(options.outPath);
+    if (!out) {
+        printf("Error opening %s\n", options.outPath.c_str());
+        return false;
+    }
+
+    std::string csv = "run,level_file,input,seed,outcome,score,damage_taken,ticks_survived,enemies_killed,enemies_escaped\n";
+    for (size_t row = 0; row < results.seed.size(); row++) {
+        csv += std::format("{},{},{},{},{},{},{},{},{},{}\n", row, options.levelFiles[results.level[row]], options.policies[results.policy[row]].name, results.seed[row],
+            outcomeName(results.outcome[row]), results.score[row], results.damageTaken[row], results.ticks[row], results.enemiesKilled[row], results.enemiesEscaped[row]);
+        if (csv.size() > (1 << 20)) {       //written a megabyte at a time
+            out << csv;
+            csv.clear();
+        }
+    }
+    out << csv;
+    if (!out) {
+        printf("Error writing %s\n", options.outPath.c_str());
+        return false;
+    }
+    return true;
+}
+
+static void printSummary(const BatchOptions& options, const BatchColumns& results) {       //one block per level file and input, rows of a block are contiguous
+    size_t row = 0;
+    while (row < results.seed.size()) {
+        size_t first = row;
+        int victories = 0;
+        int gameOvers = 0;
+        double score = 0.0;
+        double damage = 0.0;
+        double ticks = 0.0;
+        for (; row < results.seed.size() && results.level[row] == results.level[first] && results.policy[row] == results.policy[first]; row++) {
+            victories += results.outcome[row] == Outcome::Victory ? 1 : 0;
+            gameOvers += results.outcome[row] == Outcome::GameOver ? 1 : 0;
+            score += results.score[row];
+            damage += results.damageTaken[row];
+            ticks += static_cast<double>(results.ticks[row]);
+        }
+        double runs = static_cast<double>(row - first);
+        printf("%s / %s: runs %d, victories %.1f%%, game overs %.1f%%, mean score %.1f, mean damage %.2f, mean ticks %.0f\n",
+            options.levelFiles[results.level[first]].c_str(), options.policies[results.policy[first]].name.c_str(), static_cast<int>(runs),
+            100.0 * victories / runs, 100.0 * gameOvers / runs, score / runs, damage / runs, ticks / runs);
+    }
+}
+
+int main(int argc, char* argv[]) {
+    BatchOptions options = { {}, {}, {}, 100, 1, 18000, 60, 0, "batch_results.csv" };
+    if (!parseOptions(argc, argv, options))
+        return 1;
+    if (options.policies.empty() && !parsePolicies("fire,sweep,random", options.policies))
+        return 1;
+
+    //same play area as the game on a screen of that size
+    int playWidth = static_cast<int>(SCREEN_WIDTH * 0.35f);
+    PlayBounds bounds = { (SCREEN_WIDTH - playWidth) / 2, playWidth, SCREEN_HEIGHT };
+
+    if (options.levels.empty() && options.levelFiles.empty())
+        options.levels = { 1, 2 };
+    if (!options.levels.empty()) {
+        World order(bounds);
+        order.loadLevelOrder();
+        for (int level : options.levels)
+            options.levelFiles.push_back(order.getLevelFilename(level));
+    }
+    for (const std::string& levelFile : options.levelFiles) {
+        if (!std::ifstream(levelFile)) {
+            printf("Error opening level file %s\n", levelFile.c_str());
+            return 1;
+        }
+    }
+
+    //every level with every input, the same seeds for each so the combinations can be compared run for run
+    size_t count = options.levelFiles.size() * options.policies.size() * options.runs;
+    if (count > 100000000) {
+        printf("Error: %zu runs is too many for one batch\n", count);
+        return 1;
+    }
+    BatchColumns results;
+    results.resize(count);
+    size_t row = 0;
+    for (int l = 0; l < static_cast<int>(options.levelFiles.size()); l++) {
+        for (int p = 0; p < static_cast<int>(options.policies.size()); p++) {
+            for (int r = 0; r < options.runs; r++) {
+                results.level[row] = l;
+                results.policy[row] = p;
+                results.seed[row] = options.seed + r;
+                row++;
+            }
+        }
+    }
+
+    //the bullet kernel is picked on first use, warm it up so the first runs do not pay for it
+    getBulletKernelName();
+
+    JobPool pool(options.threads);
+    Uint64 start = SDL_GetTicksNS();
+    pool.run(static_cast<int>(count), [&](int job, int) {
+        playRun(options, bounds, job, results);
+    });
+    Uint64 elapsed = SDL_GetTicksNS() - start;
+
+    double totalTicks = 0.0;
+    for (Uint64 ticks : results.ticks)
+        totalTicks += static_cast<double>(ticks);
+    double seconds = static_cast<double>(elapsed) / SDL_NS_PER_SECOND;
+
+    printSummary(options, results);
+    printf("runs: %zu\n", count);
+    printf("threads: %d\n", pool.getThreadCount());
+    printf("steals: %d\n", pool.getSteals());
+    printf("wall_ms: %.2f\n", seconds * 1000.0);
+    printf("runs_per_second: %.1f\n", seconds > 0.0 ? count / seconds : 0.0);
+    printf("ticks_per_second: %.0f\n", seconds > 0.0 ? totalTicks / seconds : 0.0);
+    printf("bullet_kernel: %s\n", getBulletKernelName());
+
+    return writeResults(options, results) ? 0 : 1;
+}
@@ -0,0 +1,67 @@
+#include "jobpool.h"
+#include <thread>
+
+static int resolveThreadCount(int threads) {       //hardware_concurrency() may not know and answer 0
+    if (threads <= 0)
+        threads = static_cast<int>(std::thread::hardware_concurrency());
+    return threads > 0 ? threads : 1;
+}
+
+JobPool::JobPool(int threads) : threadCount(resolveThreadCount(threads)), queues(threadCount), steals(0) {
+}
+
+void JobPool::run(int jobCount, const std::function<void(int job, int worker)>& job) {
+    //contiguous shares, neighbouring jobs are often alike so each worker starts on a similar load
+    for (int w = 0; w < threadCount; w++) {
+        int first = static_cast<int>(static_cast<long long>(jobCount) * w / threadCount);
+        int last = static_cast<int>(static_cast<long long>(jobCount) * (w + 1) / threadCount);
+        for (int j = first; j < last; j++)
+            queues[w].jobs.push_back(j);
+    }
+    steals = 0;
+
+    std::vector<std::thread> workers;
+    for (int w = 1; w < threadCount; w++)
+        workers.emplace_back(&JobPool::work, this, w, std::cref(job));
+    work(0, job);       //the calling thread is worker 0
+    for (std::thread& worker : workers)
+        worker.join();
+}
+
+void JobPool::work(int worker, const std::function<void(int job, int worker)>& job) {
+    int next;
+    while (takeOwn(worker, next) || steal(worker, next))
+        job(next, worker);
+}
+
+bool JobPool::takeOwn(int worker, int& job) {
+    WorkQueue& queue = queues[worker];
+    std::lock_guard<std::mutex> lock(queue.mutex);
+    if (queue.jobs.empty())
+        return false;
+    job = queue.jobs.front();
+    queue.jobs.pop_front();
+    return true;
+}
+
+bool JobPool::steal(int worker, int& job) {     //no job is added while running, so empty everywhere means done
+    for (int i = 1; i < threadCount; i++) {
+        WorkQueue& victim = queues[(worker + i) % threadCount];
+        std::lock_guard<std::mutex> lock(victim.mutex);
+        if (victim.jobs.empty())
+            continue;
+        job = victim.jobs.back();
+        victim.jobs.pop_back();
+        steals++;
+        return true;
+    }
+    return false;
+}
+
+int JobPool::getThreadCount() const {
+    return threadCount;
+}
+
+int JobPool::getSteals() const {
+    return steals;
+}
@@ -0,0 +1,33 @@
+#pragma once
+#include <atomic>
+#include <deque>
+#include <functional>
+#include <mutex>
+#include <vector>
+
+// Runs a fixed set of jobs on worker threads with work stealing. Each worker starts with its own
+// contiguous share of the jobs and takes them from the front; once its share is done it steals from the
+// back of another worker's share, so a few long jobs (a level played to the end next to quick game overs)
+// do not leave the other cores idle. The jobs are whole playthroughs, a lock per queue costs nothing next to them.
+class JobPool {
+private:
+    struct WorkQueue {
+        std::mutex mutex;
+        std::deque<int> jobs;
+    };
+
+    int threadCount;
+    std::vector<WorkQueue> queues;      // one per worker
+    std::atomic<int> steals;
+
+    bool takeOwn(int worker, int& job);
+    bool steal(int worker, int& job);
+    void work(int worker, const std::function<void(int job, int worker)>& job);
+
+public:
+    JobPool(int threads);       // 0 for one thread per core
+
+    void run(int jobCount, const std::function<void(int job, int worker)>& job);       // returns once every job ran
+    int getThreadCount() const;
+    int getSteals() const;      // jobs run by another worker than the one they were given to, during the last run()
+};
@@ -0,0 +1,382 @@
+#include <SDL3/SDL.h>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <format>
+#include <fstream>
+#include <string>
+#include <vector>
+#include "world.h"
+#include "input.h"
+#include "snapshot.h"
+#include "texturecache.h"
+#include "playfield.h"
+#include "renderbatch.h"
+#include "worldrenderer.h"
+
+// Throughput benchmark: plays a level file uncapped for a fixed number of ticks, on the bare simulation
+// and again drawing every tick with the software renderer, then prints the results as JSON.
+// Run it from the game folder, the level files and the assets are looked up from there.
+
+static const int SCREEN_WIDTH = 1920;      //same virtual screen as the game's headless runs
+static const int SCREEN_HEIGHT = 1080;
+
+enum class BenchInput { Idle, Fire, Script };
+
+struct BenchOptions {
+    int level;
+    std::string levelFile;      // overrides level when set
+    Uint64 ticks;
+    int tickRate;
+    BenchInput input;
+    std::string scriptPath;
+    bool simulation;            // run without rendering
+    bool render;                // run with the software renderer
+    std::string outPath;        // stdout when empty
+};
+
+struct BenchResult {
+    const char* mode;
+    Uint64 ticks;
+    Uint64 wallNS;
+    StepTimings timings;
+    Uint64 renderNS;
+    int levelsPlayed;       // the level restarts when it ends before the tick count
+    int victories;
+    int gameOvers;
+    int enemiesKilled;      // over every level played
+    int enemiesEscaped;
+    int peakEnemies;
+    int peakPlayerBullets;
+    int peakEnemyBullets;
+    int finalEnemies;
+    int finalPending;
+    int finalPlayerBullets;
+    int finalEnemyBullets;
+};
+
+// Same draw path as a game frame, without the hud and the menus
+struct OffscreenRenderer {
+    SDL_Window* window;
+    SDL_Renderer* renderer;
+    TextureCache* textures;
+    Playfield* playfield;
+    WorldRenderer* worldRenderer;
+    RenderBatch* batch;
+    RenderSnapshot snapshot;
+};
+
+static bool readNumber(const char* text, long long& value) {      //the whole argument has to be a number
+    char* end = nullptr;
+    value = std::strtoll(text, &end, 10);
+    return end != text && *end == '\0';
+}
+
+static void printUsage(const char* program) {
+    fprintf(stderr, "usage: %s [--level 1|2 | --level-file <path>] [--ticks N] [--tick-rate N] [--input idle|fire|script:<path>] [--mode sim|render|both] [--out <path>]\n", program);
+}
+
+static bool parseOptions(int argc, char* argv[], BenchOptions& options) {
+    for (int i = 1; i < argc; i++) {
+        const char* arg = argv[i];
+        const char* value = i + 1 < argc ? argv[i + 1] : nullptr;
+        long long number = 0;
+
+        if (std::strcmp(arg, "--level") == 0 && value) {
+            if (!readNumber(value, number) || number < 1 || number > 2) {
+                fprintf(stderr, "Error: --level expects 1 or 2\n");
+                return false;
+            }
+            options.level = static_cast<int>(number);
+            i++;
+        }
+        else if (std::strcmp(arg, "--level-file") == 0 && value) {
+            options.levelFile = value;
+            i++;
+        }
+        else if (std::strcmp(arg, "--ticks") == 0 && value) {
+            if (!readNumber(value, number) || number < 1) {
+                fprintf(stderr, "Error: --ticks expects a positive number\n");
+                return false;
+            }
+            options.ticks = static_cast<Uint64>(number);
+            i++;
+        }
+        else if (std::strcmp(arg, "--tick-rate") == 0 && value) {
+            if (!readNumber(value, number) || number < 1 || number > 1000) {
+                fprintf(stderr, "Error: --tick-rate expects a number between 1 and 1000\n");
+                return false;
+            }
+            options.tickRate = static_cast<int>(number);
+            i++;
+        }
+        else if (std::strcmp(arg, "--input") == 0 && value) {
+            if (std::strcmp(value, "idle") == 0)
+                options.input = BenchInput::Idle;
+            else if (std::strcmp(value, "fire") == 0)
+                options.input = BenchInput::Fire;
+            else if (std::strncmp(value, "script:", 7) == 0 && value[7] != '\0') {
+                options.input = BenchInput::Script;
+                options.scriptPath = value + 7;
+            }
+            else {
+                fprintf(stderr, "Error: --input expects idle, fire or script:<path>\n");
+                return false;
+            }
+            i++;
+        }
+        else if (std::strcmp(arg, "--mode") == 0 && value) {
+            options.simulation = std::strcmp(value, "sim") == 0 || std::strcmp(value, "both") == 0;
+            options.render = std::strcmp(value, "render") == 0 || std::strcmp(value, "both") == 0;
+            if (!options.simulation && !options.render) {
+                fprintf(stderr, "Error: --mode expects sim, render or both\n");
+                return false;
+            }
+            i++;
+        }
+        else if (std::strcmp(arg, "--out") == 0 && value) {
+            options.outPath = value;
+            i++;
+        }
+        else {
+            fprintf(stderr, "Error: unknown or incomplete option %s\n", arg);
+            printUsage(argv[0]);
+            return false;
+        }
+    }
+    return true;
+}
+
+static bool createOffscreen(OffscreenRenderer& offscreen, const PlayBounds& bounds) {      //hidden window on the offscreen driver, software renderer
+    SDL_SetHint(SDL_HINT_VIDEO_DRIVER, "offscreen");
+    if (!SDL_Init(SDL_INIT_VIDEO)) {
+        fprintf(stderr, "Error SDL_Init: %s\n", SDL_GetError());
+        return false;
+    }
+    offscreen.window = SDL_CreateWindow("Shoot 'Em Up benchmark", SCREEN_WIDTH, SCREEN_HEIGHT, SDL_WINDOW_HIDDEN);
+    if (!offscreen.window) {
+        fprintf(stderr, "Error creating offscreen window: %s\n", SDL_GetError());
+        return false;
+    }
+    offscreen.renderer = SDL_CreateRenderer(offscreen.window, SDL_SOFTWARE_RENDERER);
+    if (!offscreen.renderer) {
+        fprintf(stderr, "Error creating software renderer: %s\n", SDL_GetError());
+        return false;
+    }
+
+    offscreen.textures = new TextureCache(offscreen.renderer);
+    if (!offscreen.textures->buildAtlas("assets"))
+        fprintf(stderr, "Warning: could not build texture atlas\n");
+    offscreen.playfield = new Playfield(offscreen.renderer, offscreen.textures->load("assets/background.png"));
+    offscreen.playfield->setArea(bounds.x, 0, bounds.width, bounds.height, SCREEN_WIDTH, SCREEN_HEIGHT);
+    offscreen.worldRenderer = new WorldRenderer(*offscreen.textures);
+    offscreen.batch = new RenderBatch();
+    return true;
+}
+
+static void destroyOffscreen(OffscreenRenderer& offscreen) {        //the sprite holders go before the cache, the cache before the renderer
+    delete offscreen.batch;
+    delete offscreen.worldRenderer;
+    delete offscreen.playfield;
+    delete offscreen.textures;
+    if (offscreen.renderer)
+        SDL_DestroyRenderer(offscreen.renderer);
+    if (offscreen.window)
+        SDL_DestroyWindow(offscreen.window);
+    offscreen = {};
+    SDL_Quit();
+}
+
+static void drawFrame(OffscreenRenderer& offscreen, const World& world) {
+    captureSnapshot(world, SDL_GetTicksNS(), offscreen.snapshot);
+    SDL_SetRenderDrawColor(offscreen.renderer, 0, 0, 0, 255);
+    SDL_RenderClear(offscreen.renderer);
+    offscreen.playfield->drawBackground();
+    offscreen.playfield->beginWorld();
+    offscreen.worldRenderer->draw(offscreen.snapshot, *offscreen.batch, 1.0f);
+    offscreen.batch->flush(offscreen.renderer);
+    offscreen.playfield->endWorld();
+    SDL_RenderPresent(offscreen.renderer);
+}
+
+static bool runBenchmark(const BenchOptions& options, const std::string& levelFile, const PlayBounds& bounds, bool render, BenchResult& result) {
+    InputScript script;
+    if (options.input == BenchInput::Script && !script.load(options.scriptPath.c_str()))
+        return false;
+
+    OffscreenRenderer offscreen = {};
+    if (render && !createOffscreen(offscreen, bounds)) {
+        destroyOffscreen(offscreen);
+        return false;
+    }
+
+    World world(bounds);
+    world.loadLevelFile(levelFile);
+    world.setTimingEnabled(true);
+
+    result = {};
+    result.mode = render ? "software_render" : "simulation";
+    result.levelsPlayed = 1;
+    const float dt = 1.0f / options.tickRate;
+    InputFrame input = {};
+    input.fire = options.input == BenchInput::Fire;
+
+    Uint64 start = SDL_GetTicksNS();
+    for (Uint64 tick = 0; tick < options.ticks; tick++) {
+        if (options.input == BenchInput::Script)
+            input = script.advance(tick);
+        world.step(input, dt);
+
+        if (render) {
+            Uint64 renderStart = SDL_GetTicksNS();
+            drawFrame(offscreen, world);
+            result.renderNS += SDL_GetTicksNS() - renderStart;
+        }
+
+        const EnemyManager& enemies = world.getEnemies();
+        result.peakEnemies = SDL_max(result.peakEnemies, enemies.countAlive());
+        result.peakPlayerBullets = SDL_max(result.peakPlayerBullets, world.getPlayerBullets().getCount());
+        result.peakEnemyBullets = SDL_max(result.peakEnemyBullets, world.getEnemyBullets().getCount());
+
+        //a level that ends early is played again, so every tick measures a running game
+        const GameState& state = world.getState();
+        if (state.isVictory() || state.isGameOver()) {
+            result.victories += state.isVictory() ? 1 : 0;
+            result.gameOvers += state.isGameOver() ? 1 : 0;
+            result.enemiesKilled += enemies.countKilled();
+            result.enemiesEscaped += enemies.countEscaped();
+            if (tick + 1 < options.ticks) {
+                world.reset();
+                result.levelsPlayed++;
+            }
+        }
+    }
+    result.wallNS = SDL_GetTicksNS() - start;
+    result.ticks = options.ticks;
+    result.timings = world.getTimings();
+
+    const EnemyManager& enemies = world.getEnemies();
+    if (!world.getState().isVictory() && !world.getState().isGameOver()) {
+        result.enemiesKilled += enemies.countKilled();
+        result.enemiesEscaped += enemies.countEscaped();
+    }
+    result.finalEnemies = enemies.countAlive();
+    result.finalPending = enemies.countPending();
+    result.finalPlayerBullets = world.getPlayerBullets().getCount();
+    result.finalEnemyBullets = world.getEnemyBullets().getCount();
+
+    if (render)
+        destroyOffscreen(offscreen);
+    return true;
+}
+
+static std::string quoted(const std::string& text) {       //paths may hold backslashes
+    std::string json = "\"";
+    for (char c : text) {
+        if (c == '"' || c == '\\')
+            json += '\\';
+        json += c;
+    }
+    return json + "\"";
+}
+
+static double toMS(Uint64 ns) {
+    return static_cast<double>(ns) / SDL_NS_PER_MS;
+}
+
+static void writeResult(std::string& json, const BenchResult& result) {
+    double seconds = static_cast<double>(result.wallNS) / SDL_NS_PER_SECOND;
+    json += "    {\n";
+    json += std::format("      \"mode\": \"{}\",\n", result.mode);
+    json += std::format("      \"ticks\": {},\n", result.ticks);
+    json += std::format("      \"wall_ms\": {:.3f},\n", toMS(result.wallNS));
+    json += std::format("      \"ticks_per_second\": {:.1f},\n", seconds > 0.0 ? result.ticks / seconds : 0.0);
+    json += "      \"phases_ms\": {\n";
+    json += std::format("        \"player\": {:.3f},\n", toMS(result.timings.player_ns));
+    json += std::format("        \"bullets\": {:.3f},\n", toMS(result.timings.bullets_ns));
+    json += std::format("        \"enemies\": {:.3f},\n", toMS(result.timings.enemies_ns));
+    json += std::format("        \"collisions\": {:.3f},\n", toMS(result.timings.collisions_ns));
+    json += std::format("        \"cleanup\": {:.3f},\n", toMS(result.timings.cleanup_ns));
+    json += std::format("        \"render\": {:.3f}\n", toMS(result.renderNS));
+    json += "      },\n";
+    json += std::format("      \"levels_played\": {},\n", result.levelsPlayed);
+    json += std::format("      \"victories\": {},\n", result.victories);
+    json += std::format("      \"game_overs\": {},\n", result.gameOvers);
+    json += "      \"entities\": {\n";
+    json += std::format("        \"enemies_killed\": {},\n", result.enemiesKilled);
+    json += std::format("        \"enemies_escaped\": {},\n", result.enemiesEscaped);
+    json += std::format("        \"peak_enemies\": {},\n", result.peakEnemies);
+    json += std::format("        \"peak_player_bullets\": {},\n", result.peakPlayerBullets);
+    json += std::format("        \"peak_enemy_bullets\": {},\n", result.peakEnemyBullets);
+    json += std::format("        \"final_enemies\": {},\n", result.finalEnemies);
+    json += std::format("        \"final_pending\": {},\n", result.finalPending);
+    json += std::format("        \"final_player_bullets\": {},\n", result.finalPlayerBullets);
+    json += std::format("        \"final_enemy_bullets\": {}\n", result.finalEnemyBullets);
+    json += "      }\n";
+    json += "    }";
+}
+
+static std::string buildReport(const BenchOptions& options, const std::string& levelFile, const std::vector<BenchResult>& results) {
+    const char* inputName = options.input == BenchInput::Fire ? "fire" : options.input == BenchInput::Script ? "script" : "idle";
+    std::string json = "{\n";
+    json += std::format("  \"level_file\": {},\n", quoted(levelFile));
+    json += std::format("  \"tick_rate\": {},\n", options.tickRate);
+    json += std::format("  \"input\": \"{}\",\n", inputName);
+    json += std::format("  \"bullet_kernel\": \"{}\",\n", getBulletKernelName());
+    json += "  \"runs\": [\n";
+    for (size_t i = 0; i < results.size(); i++) {
+        writeResult(json, results[i]);
+        json += i + 1 < results.size() ? ",\n" : "\n";
+    }
+    json += "  ]\n";
+    json += "}\n";
+    return json;
+}
+
+int main(int argc, char* argv[]) {
+    BenchOptions options = { 1, "", 3600, 60, BenchInput::Fire, "", true, true, "" };
+    if (!parseOptions(argc, argv, options))
+        return 1;
+
+    //same play area as the game on a screen of that size
+    int playWidth = static_cast<int>(SCREEN_WIDTH * 0.35f);
+    PlayBounds bounds = { (SCREEN_WIDTH - playWidth) / 2, playWidth, SCREEN_HEIGHT };
+
+    std::string levelFile = options.levelFile;
+    if (levelFile.empty()) {
+        World order(bounds);
+        order.loadLevelOrder();
+        levelFile = order.getLevelFilename(options.level);
+    }
+    if (!std::ifstream(levelFile)) {
+        fprintf(stderr, "Error opening level file %s\n", levelFile.c_str());
+        return 1;
+    }
+
+    //the bullet kernel is picked on first use, warm it up so the first run does not pay for it
+    getBulletKernelName();
+
+    std::vector<BenchResult> results;
+    for (int pass = 0; pass < 2; pass++) {
+        bool render = pass == 1;
+        if (render ? !options.render : !options.simulation)
+            continue;
+        BenchResult result;
+        if (!runBenchmark(options, levelFile, bounds, render, result))
+            return 1;
+        results.push_back(result);
+    }
+
+    std::string report = buildReport(options, levelFile, results);
+    if (options.outPath.empty()) {
+        fputs(report.c_str(), stdout);
+        return 0;
+    }
+    std::ofstream out(options.outPath);
+    if (!out) {
+        fprintf(stderr, "Error opening %s\n", options.outPath.c_str());
+        return 1;
+    }
+    out << report;
+    return 0;
+}
@@ -0,0 +1,234 @@
+#include <cerrno>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <random>
+#include <string>
+#include <vector>
+#include "seed.h"
+
+// Stress level generator: writes enemy files in the format EnemyManager::setupEnemies reads
+// (x in the play area, start y above the screen, w, h, speed, type, one value per line and a blank
+// line after each enemy). The same options and seed always give the same file, on any compiler:
+// only the raw mt19937_64 sequence is used, the standard distributions are not.
+
+static const char* TYPE_NAMES[3] = { "tomato", "broccoli", "carrot" };
+
+struct GenOptions {
+    long long count;
+    std::uint64_t seed;
+    float playWidth;                // x is drawn in [0, playWidth - w]
+    float depth;                    // the enemies start up to this far above the screen, 0 for 110 per enemy
+    std::vector<double> bands;      // relative density of equal slices of depth, the first one is nearest the screen
+    double mix[3];                  // tomato, broccoli, carrot weights
+    float minSpeed;
+    float maxSpeed;
+    float w;
+    float h;
+    std::string outPath;            // stdout when empty
+};
+
+static bool readNumber(const char* text, double& value) {      //the whole argument has to be a number
+    char* end = nullptr;
+    value = std::strtod(text, &end);
+    return end != text && *end == '\0';
+}
+
+static bool readWholeNumber(const char* text, long long& value) {      //digits only, "1.5" or "1e3" are not counts
+    if (*text < '0' || *text > '9')
+        return false;
+    char* end = nullptr;
+    errno = 0;
+    value = std::strtoll(text, &end, 10);
+    return *end == '\0' && errno != ERANGE;
+}
+
+static bool readList(const char* text, char separator, std::vector<double>& values) {     //"a<sep>b<sep>c", every value positive or zero
+    values.clear();
+    std::string item;
+    for (const char* c = text; ; c++) {
+        if (*c == separator || *c == '\0') {
+            double value = 0.0;
+            if (!readNumber(item.c_str(), value) || value < 0.0)
+                return false;
+            values.push_back(value);
+            item.clear();
+            if (*c == '\0')
+                break;
+        }
+        else
+            item += *c;
+    }
+    return true;
+}
+
+static void printUsage(const char* program) {
+    printf("usage: %s [--count N] [--seed S] [--width W] [--depth D] [--bands w1,w2,...] [--mix tomato:broccoli:carrot] [--speed MIN:MAX] [--size W:H] [--out <path>]\n", program);
+}
+
+static bool parseOptions(int argc, char* argv[], GenOptions& options) {
+    for (int i = 1; i < argc; i++) {
+        const char* arg = argv[i];
+        const char* value = i + 1 < argc ? argv[i + 1] : nullptr;
+        double number = 0.0;
+        long long whole = 0;
+        std::vector<double> list;
+
+        if (std::strcmp(arg, "--count") == 0 && value) {
+            if (!readWholeNumber(value, whole) || whole < 1 || whole > 100000000) {
+                printf("Error: --count expects a whole number between 1 and 100000000\n");
+                return false;
+            }
+            options.count = whole;
+            i++;
+        }
+        else if (std::strcmp(arg, "--seed") == 0 && value) {
+            if (!parseSeed(value, options.seed)) {
+                printf("Error: --seed expects a whole number between 0 and 18446744073709551615\n");
+                return false;
+            }
+            i++;
+        }
+        else if (std::strcmp(arg, "--width") == 0 && value) {
+            if (!readNumber(value, number) || number <= 0) {
+                printf("Error: --width expects a positive number\n");
+                return false;
+            }
+            options.playWidth = static_cast<float>(number);
+            i++;
+        }
+        else if (std::strcmp(arg, "--depth") == 0 && value) {
+            if (!readNumber(value, number) || number < 0) {
+                printf("Error: --depth expects a positive number\n");
+                return false;
+            }
+            options.depth = static_cast<float>(number);
+            i++;
+        }
+        else if (std::strcmp(arg, "--bands") == 0 && value) {
+            if (!readList(value, ',', list) || list.empty()) {
+                printf("Error: --bands expects weights like 1,4,1\n");
+                return false;
+            }
+            options.bands = list;
+            i++;
+        }
+        else if (std::strcmp(arg, "--mix") == 0 && value) {
+            if (!readList(value, ':', list) || list.size() != 3 || list[0] + list[1] + list[2] <= 0.0) {
+                printf("Error: --mix expects tomato:broccoli:carrot weights like 1:2:1\n");
+                return false;
+            }
+            for (int t = 0; t < 3; t++)
+                options.mix[t] = list[t];
+            i++;
+        }
+        else if (std::strcmp(arg, "--speed") == 0 && value) {
+            if (!readList(value, ':', list) || list.size() != 2 || list[0] > list[1]) {
+                printf("Error: --speed expects MIN:MAX\n");
+                return false;
+            }
+            options.minSpeed = static_cast<float>(list[0]);
+            options.maxSpeed = static_cast<float>(list[1]);
+            i++;
+        }
+        else if (std::strcmp(arg, "--size") == 0 && value) {
+            if (!readList(value, ':', list) || list.size() != 2 || list[0] <= 0.0 || list[1] <= 0.0) {
+                printf("Error: --size expects W:H\n");
+                return false;
+            }
+            options.w = static_cast<float>(list[0]);
+            options.h = static_cast<float>(list[1]);
+            i++;
+        }
+        else if (std::strcmp(arg, "--out") == 0 && value) {
+            options.outPath = value;
+            i++;
+        }
+        else {
+            printf("Error: unknown or incomplete option %s\n", arg);
+            printUsage(argv[0]);
+            return false;
+        }
+    }
+    return true;
+}
+
+static double unit(std::mt19937_64& random) {      //[0, 1) from the top 53 bits
+    return static_cast<double>(random() >> 11) * (1.0 / 9007199254740992.0);
+}
+
+static int pick(std::mt19937_64& random, const std::vector<double>& cumulative) {      //index drawn by weight
+    double target = unit(random) * cumulative.back();
+    int index = 0;
+    while (index + 1 < static_cast<int>(cumulative.size()) && target >= cumulative[index])
+        index++;
+    return index;
+}
+
+static std::vector<double> accumulate(const double* weights, size_t count) {
+    std::vector<double> cumulative(count);
+    double total = 0.0;
+    for (size_t i = 0; i < count; i++) {
+        total += weights[i];
+        cumulative[i] = total;
+    }
+    return cumulative;
+}
+
+int main(int argc, char* argv[]) {
+    GenOptions options = { 1000, 1, 672.0f, 0.0f, { 1.0 }, { 1.0, 1.0, 1.0 }, 100.0f, 130.0f, 50.0f, 50.0f, "" };
+    if (!parseOptions(argc, argv, options))
+        return 1;
+    if (options.playWidth < options.w) {
+        printf("Error: the enemies are wider than the play area\n");
+        return 1;
+    }
+
+    //the hand-written levels space their enemies about 110 pixels apart
+    double depth = options.depth > 0.0f ? options.depth : 110.0 * options.count;
+    double bandHeight = depth / options.bands.size();
+    std::vector<double> bands = accumulate(options.bands.data(), options.bands.size());
+    std::vector<double> types = accumulate(options.mix, 3);
+    if (bands.back() <= 0.0) {
+        printf("Error: every band has a weight of 0\n");
+        return 1;
+    }
+
+    std::ofstream file;
+    if (!options.outPath.empty()) {
+        file.open(options.outPath, std::ios::binary);
+        if (!file) {
+            printf("Error opening %s\n", options.outPath.c_str());
+            return 1;
+        }
+    }
+
+    std::mt19937_64 random(options.seed);
+    std::string chunk;
+    chunk.reserve(1 << 20);
+    char line[160];
+    for (long long i = 0; i < options.count; i++) {
+        int band = pick(random, bands);
+        double y = -(band + unit(random)) * bandHeight;
+        double x = unit(random) * (options.playWidth - options.w);
+        double speed = options.minSpeed + unit(random) * (options.maxSpeed - options.minSpeed);
+        const char* type = TYPE_NAMES[pick(random, types)];
+
+        int length = std::snprintf(line, sizeof(line), "%.1f\n%.1f\n%.1f\n%.1f\n%.1f\n%s\n\n", x, y, options.w, options.h, speed, type);
+        chunk.append(line, length);
+        if (chunk.size() > (1 << 20) - sizeof(line) || i + 1 == options.count) {      //written a megabyte at a time
+            if (file.is_open())
+                file.write(chunk.data(), chunk.size());
+            else
+                std::fwrite(chunk.data(), 1, chunk.size(), stdout);
+            chunk.clear();
+        }
+    }
+
+    if (file.is_open() && !file) {
+        printf("Error writing %s\n", options.outPath.c_str());
+        return 1;
+    }
+    return 0;
+}
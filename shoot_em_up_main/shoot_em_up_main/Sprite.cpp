@@ -1,21 +1,22 @@
 #include "Sprite.h"
 #include <SDL3_image/SDL_image.h>
 #include <SDL3/SDL.h>
+#include <cstdio>
 #include <iostream>
 
-Sprite::Sprite(SDL_Renderer* renderer, const char* path) : texture(nullptr), width(0), height(0){ //parameters, check if texture loaded
+Sprite::Sprite(SDL_Renderer* renderer, const char* path) : texture(nullptr), source{ 0, 0, 0, 0 }, uv{ 0, 0, 1, 1 }, width(0), height(0), ownsTexture(true){ //parameters, check if texture loaded
     if (!renderer || !path) 
         return;
 
     SDL_Surface* surface = IMG_Load(path);
     if (!surface) {
-        printf("Error loading image");
+        fprintf(stderr, "Error loading image\n");
         return;
     }
 
     texture = SDL_CreateTextureFromSurface(renderer, surface);
     if (!texture) {
-        printf("Error creating texture");
+        fprintf(stderr, "Error creating texture\n");
         SDL_DestroySurface(surface);
         return;
     }
@@ -24,16 +25,45 @@ Sprite::Sprite(SDL_Renderer* renderer, const char* path) : texture(nullptr), wid
 
     width = surface->w;
     height = surface->h;
+    source = { 0.0f, 0.0f, static_cast<float>(width), static_cast<float>(height) };
 
     SDL_DestroySurface(surface);
 }
 
+Sprite::Sprite(SDL_Texture* texture) : texture(texture), source{ 0, 0, 0, 0 }, uv{ 0, 0, 1, 1 }, width(0), height(0), ownsTexture(true) {
+    if (!texture)
+        return;
+
+    float w = 0.0f;
+    float h = 0.0f;
+    SDL_GetTextureSize(texture, &w, &h);
+    setRegion({ 0.0f, 0.0f, w, h });
+}
+
+Sprite::Sprite(SDL_Texture* page, const SDL_FRect& region) : texture(page), source{ 0, 0, 0, 0 }, uv{ 0, 0, 1, 1 }, width(0), height(0), ownsTexture(false) {
+    if (texture)
+        setRegion(region);
+}
+
 Sprite::~Sprite() {     //destructor
-    SDL_DestroyTexture(texture);
+    if (ownsTexture)
+        SDL_DestroyTexture(texture);
     texture = nullptr;
     
 }
 
+void Sprite::setRegion(const SDL_FRect& region) {       //source rectangle in pixels and in texture coordinates
+    source = region;
+    width = static_cast<int>(region.w);
+    height = static_cast<int>(region.h);
+
+    float textureW = 0.0f;
+    float textureH = 0.0f;
+    SDL_GetTextureSize(texture, &textureW, &textureH);
+    if (textureW > 0.0f && textureH > 0.0f)
+        uv = { region.x / textureW, region.y / textureH, region.w / textureW, region.h / textureH };
+}
+
 bool Sprite::IsValid() const {
     return texture != nullptr;
 }
@@ -50,8 +80,18 @@ SDL_Texture* Sprite::GetTexture() const {
     return texture;
 }
 
+const SDL_FRect& Sprite::GetSource() const {
+    return source;
+}
+
 void Sprite::Draw(SDL_Renderer* renderer, const SDL_FRect* dstRect) const {
-    if (!renderer || !texture || !dstRect) 
+    if (!renderer || !texture) 
         return;
-    SDL_RenderTexture(renderer, texture, nullptr, dstRect);
-}
\ No newline at end of file
+    SDL_RenderTexture(renderer, texture, &source, dstRect);
+}
+
+void Sprite::Draw(RenderBatch& batch, const SDL_FRect& dstRect, RenderLayer layer, float alpha) const {     //queue the sprite in the frame's draw list
+    if (!texture)
+        return;
+    batch.addTexture(texture, uv, dstRect, layer, alpha);
+}
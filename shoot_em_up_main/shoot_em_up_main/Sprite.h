@@ -1,14 +1,22 @@
 #pragma once
 #include <SDL3/SDL.h>
+#include "renderbatch.h"
 
 class Sprite {
 private:
     SDL_Texture* texture;
+    SDL_FRect source;       // region of the texture, the whole texture unless it lives in an atlas
+    SDL_FRect uv;           // same region in normalized coordinates, for geometry batches
     int width;
     int height;
+    bool ownsTexture;       // atlas regions share their page with other sprites
+
+    void setRegion(const SDL_FRect& region);
 
 public:
     Sprite(SDL_Renderer* renderer, const char* path);
+    Sprite(SDL_Texture* texture);       // takes ownership of an already created texture
+    Sprite(SDL_Texture* page, const SDL_FRect& region);     // region of an atlas page, the page stays owned by the atlas
     ~Sprite();
 
     // Delete copy constructor and assignment
@@ -19,5 +27,7 @@ public:
     int GetWidth() const;
     int GetHeight() const;
     SDL_Texture* GetTexture() const;
+    const SDL_FRect& GetSource() const;
     void Draw(SDL_Renderer* renderer, const SDL_FRect* dstRect) const;
+    void Draw(RenderBatch& batch, const SDL_FRect& dstRect, RenderLayer layer, float alpha = 1.0f) const;
 };
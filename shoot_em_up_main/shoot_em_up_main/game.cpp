@@ -3,8 +3,12 @@
 #include <format>
 #include <print>
 
-Game::Game() : window(nullptr), renderer(nullptr), bgTexture(nullptr), screenWidth(0), screenHeight(0), playAreaX(0), playAreaWidth(0), player(nullptr), bulletManager(nullptr),
-enemyBulletManager(nullptr), enemyManager(nullptr), gameState(nullptr), gameMenu(nullptr), initialPlayerX(0.0f), initialPlayerY(0.0f), running(true), lastTime(0), currentLevel(1) {
+static const int HEADLESS_WIDTH = 1920;        //virtual screen of headless runs, the play area is computed from it
+static const int HEADLESS_HEIGHT = 1080;
+
+Game::Game() : window(nullptr), renderer(nullptr), textures(nullptr), playfield(nullptr), screenWidth(0), screenHeight(0), playAreaX(0), playAreaWidth(0), world(nullptr),
+gameMenu(nullptr), hud(nullptr), renderBatch(nullptr), worldRenderer(nullptr), running(true), tickRate(60), maxCatchUpTicks(5), vsyncEnabled(false), frameDurationNS(SDL_NS_PER_SECOND / 60), seed(1), profilePath("profile.json"),
+currentInput{}, recorder(nullptr), simulating(false), pendingInput{}, shownMenu(MenuState::None) {
 }
 
 Game::~Game() {
@@ -18,6 +22,40 @@ bool Game::initialize() {       //initialisation of the window
     if (!loadResources())
         return false;
     setupGameObjects();
+    setupRendering();
+    return true;
+}
+
+bool Game::initializeHeadless(bool offscreen) {      //no display needed: only the world, or offscreen with a software renderer
+    screenWidth = HEADLESS_WIDTH;
+    screenHeight = HEADLESS_HEIGHT;
+
+    if (offscreen) {
+        SDL_SetHint(SDL_HINT_VIDEO_DRIVER, "offscreen");
+        if (!initSDL())
+            return false;
+        window = SDL_CreateWindow("Shoot 'Em Up", screenWidth, screenHeight, SDL_WINDOW_HIDDEN);
+        if (!window) {
+            printf("Error creating offscreen window: %s\n", SDL_GetError());
+            SDL_Quit();
+            return false;
+        }
+        renderer = SDL_CreateRenderer(window, SDL_SOFTWARE_RENDERER);
+        if (!renderer) {
+            printf("Error creating software renderer: %s\n", SDL_GetError());
+            SDL_DestroyWindow(window);
+            window = nullptr;
+            SDL_Quit();
+            return false;
+        }
+    }
+
+    calculatePlayArea();
+    if (renderer && !loadResources())
+        return false;
+    setupGameObjects();
+    if (renderer)
+        setupRendering();
     return true;
 }
 
@@ -48,49 +86,63 @@ bool Game::createRenderer() {        //renderers created
         SDL_Quit();
         return false;
     }
+
+    //present waits for the display when vsync works, otherwise frames are paced to its refresh rate
+    vsyncEnabled = SDL_SetRenderVSync(renderer, 1);
+    const SDL_DisplayMode* mode = SDL_GetCurrentDisplayMode(SDL_GetDisplayForWindow(window));
+    if (mode && mode->refresh_rate > 0.0f)
+        frameDurationNS = static_cast<Uint64>(SDL_NS_PER_SECOND / mode->refresh_rate);
     return true;
 }
 
 void Game::calculatePlayArea() {    //calculation of the area where you can play
     playAreaWidth = static_cast<int>(screenWidth * 0.35f);      //define the limits
     playAreaX = (screenWidth - playAreaWidth) / 2;
+
+    if (playfield)      //the world is clipped to this area, its background is cached at this size
+        playfield->setArea(playAreaX, 0, playAreaWidth, screenHeight, screenWidth, screenHeight);
+}
+
+void Game::handleResize() {         //the static layers are only rebuilt here
+    SDL_GetWindowSize(window, &screenWidth, &screenHeight);
+    calculatePlayArea();
+    gameMenu->setWindowSize(screenWidth, screenHeight);
+
+    //the player bounds belong to the simulation, they change between two ticks
+    WorldCommand command{ WorldCommand::Type::Resize, 0, { playAreaX, playAreaWidth, screenHeight } };
+    postCommand(command);
 }
 
 bool Game::loadResources() {        //load the ressources needed for the background
-    SDL_Surface* bgSurface = IMG_Load("assets/background.png");
-    if (bgSurface) {
-        bgTexture = SDL_CreateTextureFromSurface(renderer, bgSurface);
-        SDL_DestroySurface(bgSurface);
-        if (!bgTexture)
-            printf("Warning: could not create background texture");
-    }
-    else
+    PROFILE_ZONE("Game::loadResources");
+    textures = new TextureCache(renderer);      //every image of the game goes through it, decoded once
+    if (!textures->buildAtlas("assets"))
+        printf("Warning: could not build texture atlas");
+    std::shared_ptr<Sprite> background = textures->load("assets/background.png");
+    if (!background->IsValid())
         printf("Warning: could not load background image");
+
+    playfield = new Playfield(renderer, background);
+    calculatePlayArea();
     
    
     return true;
 }
 
-void Game::setupGameObjects() {     //set up of the objects needed throughout the game
-    initialPlayerX = playAreaX + playAreaWidth / 2.0f - 50.0f;
-    initialPlayerY = screenHeight - 150.0f;
-
-    //set up the parameters and classes associated
-    player = new Entity(initialPlayerX, initialPlayerY, 80.0f, 100.0f, 200.0f, renderer);
-    bulletManager = new BulletManager(100, 0.1f);
-    enemyBulletManager = new EnemyBulletManager(200, 0.5f);
-    enemyManager = new EnemyManager();
-    gameState = new GameState();
-    gameMenu = new Menu(renderer, screenWidth, screenHeight);
-
-
-    player->setScreenBounds(playAreaWidth, screenHeight);
-    player->setOffsetX(playAreaX);
-    // load current level file (currentLevel defaults to 1)
-    loadLevelOrder();
-    loadLevel(currentLevel);
-    enemyManager->setBulletManager(enemyBulletManager);
+void Game::setupGameObjects() {     //the simulation, it only needs the play area
+    PROFILE_ZONE("Game::setupGameObjects");
+    world = new World({ playAreaX, playAreaWidth, screenHeight });
+    world->setSeed(seed);
+    world->loadLevelOrder();
+    world->loadLevel(1);
+}
 
+void Game::setupRendering() {       //everything that needs the renderer, headless runs without one skip it
+    PROFILE_ZONE("Game::setupRendering");
+    gameMenu = new Menu(renderer, textures, screenWidth, screenHeight);
+    hud = new Hud(renderer);
+    renderBatch = new RenderBatch();
+    worldRenderer = new WorldRenderer(*textures);
 }
 
 bool Game::showMenu() {     //creation of the menu when the game is started (start menu)
@@ -98,6 +150,7 @@ bool Game::showMenu() {     //creation of the menu when the game is started (sta
     bool startGame = false;
 
     while (inMenu) {
+        Uint64 frameStart = SDL_GetTicksNS();
         SDL_Event menuEvent;
         float mouseX;
         float mouseY;
@@ -107,10 +160,10 @@ bool Game::showMenu() {     //creation of the menu when the game is started (sta
         while (SDL_PollEvent(&menuEvent)) {
             if (menuEvent.type == SDL_EVENT_QUIT)      //quit the program
                 inMenu = false;
-            if (menuEvent.type == SDL_EVENT_WINDOW_RESIZED) {       //can resize
-                SDL_GetWindowSize(window, &screenWidth, &screenHeight);
-                gameMenu->setWindowSize(screenWidth, screenHeight);
-            }
+            if (menuEvent.type == SDL_EVENT_WINDOW_RESIZED)       //can resize
+                handleResize();
+            if (menuEvent.type == SDL_EVENT_RENDER_TARGETS_RESET || menuEvent.type == SDL_EVENT_RENDER_DEVICE_RESET)
+                playfield->invalidate();
 
             //menu changes for the game state
             int menuResult = gameMenu->handleEvents(menuEvent);
@@ -130,352 +183,389 @@ bool Game::showMenu() {     //creation of the menu when the game is started (sta
 
         SDL_RenderPresent(renderer);
 
-        SDL_Delay(16);
+        paceFrame(frameStart);
     }
     return startGame;
 }
 
-void Game::run() {      //create dt and get the times needed for any speed in the game
-    lastTime = SDL_GetTicks();
-    while (running) {
-        Uint64 currentTime = SDL_GetTicks();
-        float dt = (currentTime - lastTime) / 1000.0f;
-        lastTime = currentTime;
-
-        handleEvents();
-        update(dt);
-        render();
+void Game::run() {      //the simulation runs on its own thread, this one only handles events, draws and presents
+    const Uint64 tickNS = SDL_NS_PER_SECOND / tickRate;
+    PROFILE_THREAD("main");
 
-        SDL_RenderPresent(renderer);
-        SDL_Delay(16);
-    }
-}
+    //the first frame needs something to show before the first tick is published
+    publishSnapshot(SDL_GetTicksNS());
+    startRecording();
+    simulating = true;
+    std::thread simulation(&Game::simulationLoop, this);
 
-void Game::handleEvents() {
-    SDL_Event event;
-    float mouseX;
-    float mouseY;
-    SDL_GetMouseState(&mouseX, &mouseY);
-
-    while (SDL_PollEvent(&event)) {         //events handled here
-        if (event.type == SDL_EVENT_QUIT)
-            running = false;
-
-        if (event.type == SDL_EVENT_KEY_DOWN) {
-            if (event.key.key == SDLK_R)        //used to reset the level
-                resetGame();
-
-            if (event.key.key == SDLK_ESCAPE) {     //toggle the menu pause and stop the game from continuing
-                if (!gameState->isGameOver() && !gameState->isVictory() && !gameState->isGameOver()) {
-                    gameState->togglePause();
-                    gameMenu->setPauseMode(gameState->isPaused());
-                    gameMenu->setVictoryMode(false);
-                }
-            }
+    while (running) {
+        PROFILE_ZONE("Game::frame");
+        Uint64 frameStart = SDL_GetTicksNS();
+        snapshots.update();
+        const RenderSnapshot& snapshot = snapshots.readBuffer();
+
+        syncMenu(snapshot);
+        handleEvents(snapshot);
+        postInput(readKeyboardInput(SDL_GetKeyboardState(nullptr)));
+
+        //nothing moves while a menu is shown, draw the last tick as is
+        float alpha = 1.0f;
+        if (shownMenu == MenuState::None) {
+            alpha = frameStart > snapshot.tick_time ? static_cast<float>(frameStart - snapshot.tick_time) / tickNS : 0.0f;
+            if (alpha > 1.0f)
+                alpha = 1.0f;
         }
+        else {
+            float mouseX;
+            float mouseY;
+            SDL_GetMouseState(&mouseX, &mouseY);
+            gameMenu->update(mouseX, mouseY);
+        }
+        render(snapshot, alpha);
 
-        if (gameState->isPaused() || gameState->isVictory() || gameState->isGameOver()) {       //anything but menu start
-            int menuResult = gameMenu->handleEvents(event);
-            
-            if (menuResult == 1) {
-                if (gameState->isVictory() || gameState->isGameOver()) {
-                    resetGame(); 
-                }
-                else {
-                    gameState->setPaused(false); 
-                }
-            }
-            else if (menuResult == 2) {
-                if (gameState->isVictory() && currentLevel == 1) {
-                    loadLevel(2);
-                }
-            }
-            else if (menuResult == 3) {
-                if (gameState->isVictory() && currentLevel == 2) {
-                    loadLevel(1);
-                }
-            }
-            else if (menuResult == 4) {
-                running = false;
-            }
+        {
+            PROFILE_ZONE("SDL_RenderPresent");
+            SDL_RenderPresent(renderer);
         }
+        paceFrame(frameStart);
     }
+
+    simulating = false;
+    simulation.join();
+    stopRecording();
 }
 
-void Game::update(float dt) {       //update all objects here
-    if (gameState->isActive()) {
-        const bool* keys = SDL_GetKeyboardState(nullptr);           //the keyboard entry is always updated
-        player->update(keys, dt);
+void Game::simulationLoop() {       //fixed ticks on the simulation thread, a snapshot is published after each batch
+    const Uint64 tickNS = SDL_NS_PER_SECOND / tickRate;
+    const float dt = 1.0f / tickRate;
+    Uint64 nextTick = SDL_GetTicksNS() + tickNS;
+    PROFILE_THREAD("simulation");
 
-        if (keys[SDL_SCANCODE_SPACE]) {                //the bullets are updated
-            float bullet_x = player->getRect().x + (player->getRect().w / 2.0f) - 2.5f;     //bullet adjusted correctly 
-            float bullet_y = player->getRect().y;
-            bulletManager->shoot(bullet_x, bullet_y);
+    while (simulating) {
+        Uint64 now = SDL_GetTicksNS();
+        if (now < nextTick) {
+            SDL_DelayPrecise(nextTick - now);
+            continue;
         }
 
-        //every updates about the bullets and the enemies
-        bulletManager->update(dt);
-        bulletManager->updateBullets(dt);
-        enemyManager->update(dt);
-        enemyBulletManager->update(dt);
-        enemyBulletManager->updateBullets(dt, screenHeight);
-
-        //update the collisions handled
-        handleCollisions();
-
-        if (player->getHealth() <= 0)
-            handleGameOver();       //toggle game over if health bellow 0
+        //after a hitch only catch up a few ticks instead of teleporting everything
+        Uint64 tickTime = nextTick;
+        int steps = 0;
+        while (now >= nextTick && steps < maxCatchUpTicks) {
+            applyCommands();
+            world->step(currentInput, dt);
+            if (recorder)
+                recorder->recordTick(currentInput);
+            tickTime = nextTick;
+            nextTick += tickNS;
+            steps++;
+        }
+        if (now >= nextTick)
+            nextTick = now + tickNS;
 
-        if (enemyManager->allDestroyed())
-            handleVictory();        //toggle victory if all enemies dead/out of screen and hp remaining for the player
-    }
-    else if (gameState->isPaused())     //toggle pause menu if paused
-    {
-        float mx, my;
-        SDL_GetMouseState(&mx, &my);
-        gameMenu->update(mx, my);
+        publishSnapshot(tickTime);
     }
 }
 
-void Game::render() {       //renderers for the game
-    SDL_SetRenderDrawColor(renderer, 0, 0, 0, 255);
-    SDL_RenderClear(renderer);
-
-    if (bgTexture)
-        SDL_RenderTexture(renderer, bgTexture, nullptr, nullptr);
-
-    enemyManager->draw();
-    player->draw(renderer);
-    bulletManager->draw(renderer);
-    enemyBulletManager->draw(renderer);
-
-    SDL_SetRenderDrawColor(renderer, 0, 0, 0, 255);
-    //left bar defined out of play area -> black
-    SDL_FRect leftBar = { 0.0f, 0.0f, static_cast<float>(playAreaX), static_cast<float>(screenHeight) };
-    SDL_RenderFillRect(renderer, &leftBar);
+void Game::postCommand(const WorldCommand& command) {
+    std::lock_guard<std::mutex> lock(commandMutex);
+    pendingCommands.push_back(command);
+}
 
-    //right bar defined out of play area -> black
-    SDL_FRect rightBar = { static_cast<float>(playAreaX + playAreaWidth), 0.0f, static_cast<float>(screenWidth - playAreaX - playAreaWidth), static_cast<float>(screenHeight) };
-    SDL_RenderFillRect(renderer, &rightBar);
+void Game::postInput(const InputFrame& input) {
+    std::lock_guard<std::mutex> lock(commandMutex);
+    pendingInput = input;
+}
 
-    drawScore();
+void Game::applyCommands() {        //the only place where main thread requests reach the simulation
+    PROFILE_ZONE("Game::applyCommands");
+    std::vector<WorldCommand> commands;
+    {
+        std::lock_guard<std::mutex> lock(commandMutex);
+        commands.swap(pendingCommands);
+        currentInput = pendingInput;
+    }
 
-    if (gameState->isPaused() || gameState->isVictory() || gameState->isGameOver())     //render menu in these cases
-        gameMenu->draw();
+    for (const WorldCommand& command : commands) {
+        world->apply(command);
+        if (recorder)
+            recorder->recordCommand(command);
+    }
 }
 
-void Game::handleCollisions() {     // handle all collisions in the game
-    checkOffscreenEnemies();
-    checkBulletEnemyCollisions();
-    checkPlayerEnemyCollisions();
-    checkPlayerBulletCollisions();
+void Game::publishSnapshot(Uint64 tickTime) {       //copy what the renderer needs, the live objects stay on this thread
+    PROFILE_ZONE("Game::publishSnapshot");
+    captureSnapshot(*world, tickTime, snapshots.writeBuffer());
+    snapshots.publish();
 }
 
-void Game::checkBulletEnemyCollisions() {       //count the collision between the enemy and the bullet under some conditions
-    for (auto& bullet : bulletManager->getBullets()) {
-        if (!bullet.active)
-            continue;
-        for (auto& enemy : enemyManager->getEnemies()) {
-            if (!enemy.isAlive()){
-                continue;
-            }
-            if (checkCollision(bullet.getRect(), enemy.getRect())) {        //the enemy is damaged 2hp if collision, and the bullet deactivate
-                enemy.takeDamage(2);
-                bullet.deactivate();
-                if (enemy.health <= 0)
-                    gameState->addScore(10);
-                break;
-            }
-        }
-    }
+void Game::startRecording() {        //from the level as it is now, the ticks are added as they are simulated
+    if (recordPath.empty())
+        return;
+    recorder = new Replay();
+    recorder->begin(*world, tickRate);
 }
 
-void Game::checkPlayerEnemyCollisions() {        //check if the player collides with the enemy
-    const SDL_FRect& playerRect = player->getRect();
-    for (auto& enemy : enemyManager->getEnemies()) {
-        if (!enemy.hasCollided() && enemy.isAlive() && checkCollision(playerRect, enemy.getRect())) {
-            player->takeDamage(3);      //the player loses 3hp if collided with an enemy
-            enemy.setCollided();        //cannot collide with this enemy again
-        }
-    }
-    if (enemyBulletManager->canShoot())
-        enemyManager->shootFromRandomEnemy();
+void Game::stopRecording() {
+    if (!recorder)
+        return;
+    recorder->finish(*world);
+    if (recorder->save(recordPath.c_str()))
+        printf("replay_saved: %s (%llu ticks)\n", recordPath.c_str(), static_cast<unsigned long long>(recorder->getTicks()));
+    delete recorder;
+    recorder = nullptr;
 }
 
-void Game::checkPlayerBulletCollisions() {       //check collision between the enemy's bullet and the player
-    const SDL_FRect& playerRect = player->getRect();
+int Game::runHeadless(const LaunchOptions& options) {      //no menu and no pacing, ticks as fast as possible then prints the stats
+    PROFILE_THREAD("main");
+    if (!options.replayPath.empty())
+        return runReplay(options);
+
+    InputScript script;
+    if (options.input == InputSource::Script && !script.load(options.scriptPath.c_str()))
+        return static_cast<int>(HeadlessResult::Error);
+
+    world->loadLevel(options.level);
+    startRecording();
+    const float dt = 1.0f / tickRate;
+    HeadlessResult result = HeadlessResult::Timeout;
+    Uint64 start = SDL_GetTicksNS();
+    Uint64 tick = 0;
+
+    while (tick < options.ticks) {
+        if (options.input == InputSource::Script)
+            currentInput = script.advance(tick);
+        else {
+            currentInput = {};
+            currentInput.fire = options.input == InputSource::Fire;
+        }
+        world->step(currentInput, dt);
+        if (recorder)
+            recorder->recordTick(currentInput);
+        tick++;
 
-    for (auto& enemyBullet : enemyBulletManager->getBullets()) {
-        if (!enemyBullet.active)
-            continue;
+        if (renderer)
+            renderHeadlessFrame();
 
-        if (checkCollision(playerRect, enemyBullet.getRect())) {        //the player loses 2hp if the bullet strikes
-            player->takeDamage(2);
-            enemyBullet.deactivate();
+        if (world->getState().isVictory()) {
+            result = HeadlessResult::Victory;
+            break;
+        }
+        if (world->getState().isGameOver()) {
+            result = HeadlessResult::GameOver;
+            break;
         }
     }
+
+    Uint64 elapsed = SDL_GetTicksNS() - start;
+    stopRecording();
+    printRunStats(result, tick, dt, elapsed);
+    return static_cast<int>(result);
 }
 
-void Game::checkOffscreenEnemies() {            //check off screen enemies
-    for (auto& enemy : enemyManager->getEnemies()) {
-        if (enemy.isAlive() && !enemy.hasCollided() && enemy.isOffScreen(screenHeight)) {   //if an enemy escapes, the player loses 1hp for not killing it
-            player->takeDamage(1);
-            enemy.setCollided();
-        }
+int Game::runReplay(const LaunchOptions& options) {      //plays a recorded run again tick for tick, then checks it ended the same way
+    Replay replay;
+    if (!replay.load(options.replayPath.c_str()))
+        return static_cast<int>(HeadlessResult::Error);
+
+    //the player starts from the play area the run was recorded on
+    delete world;
+    world = new World(replay.getBounds());
+    world->loadLevelOrder();
+    replay.start(*world);
+
+    Uint64 start = SDL_GetTicksNS();
+    while (replay.advance(*world)) {
+        if (renderer)
+            renderHeadlessFrame();
     }
+    Uint64 elapsed = SDL_GetTicksNS() - start;
+
+    HeadlessResult result = world->getState().isVictory() ? HeadlessResult::Victory : world->getState().isGameOver() ? HeadlessResult::GameOver : HeadlessResult::Timeout;
+    bool matches = replay.matches(*world);
+    printRunStats(result, replay.getTicks(), 1.0f / replay.getTickRate(), elapsed);
+    printf("seed: %llu\n", static_cast<unsigned long long>(replay.getSeed()));
+    printf("expected_score: %d\n", replay.getFinalScore());
+    printf("expected_health: %d\n", replay.getFinalHealth());
+    printf("replay: %s\n", matches ? "match" : "mismatch");
+    return static_cast<int>(matches ? result : HeadlessResult::ReplayMismatch);
 }
 
-bool Game::checkCollision(const SDL_FRect& a, const SDL_FRect& b) const {       //system aabb for collisions
-    return (a.x < b.x + b.w &&      //A's left edge is to the left of B's right edge
-        a.x + a.w > b.x &&          //A's right edge is to the right of B's left edge
-        a.y < b.y + b.h &&          //A's top edge is above B's bottom edge
-        a.y + a.h > b.y);           //A's bottom edge is below B's top edge
+void Game::renderHeadlessFrame() {      //offscreen: the same draw path as a real frame, nothing is shown
+    PROFILE_ZONE("Game::renderHeadlessFrame");
+    publishSnapshot(SDL_GetTicksNS());
+    snapshots.update();
+    render(snapshots.readBuffer(), 1.0f);
+    SDL_RenderPresent(renderer);
 }
 
-void Game::resetGame() {        //takes care of deleting anything not useful for the restart
-    player->resetPosition(initialPlayerX, initialPlayerY);      //reset position and health
-    player->resetHealth();
+void Game::printRunStats(HeadlessResult result, Uint64 tick, float dt, Uint64 elapsed) const {
+    const EnemyManager& enemies = world->getEnemies();
+
+    const char* resultName = result == HeadlessResult::Victory ? "victory" : result == HeadlessResult::GameOver ? "game_over" : "timeout";
+    double seconds = static_cast<double>(elapsed) / SDL_NS_PER_SECOND;
+    printf("result: %s\n", resultName);
+    printf("level: %d\n", world->getLevel());
+    printf("ticks: %llu\n", static_cast<unsigned long long>(tick));
+    printf("simulated_seconds: %.2f\n", tick * static_cast<double>(dt));
+    printf("score: %d\n", world->getState().getScore());
+    printf("health: %d\n", world->getPlayer().getHealth());
+    printf("enemies_left: %d\n", enemies.countAlive());
+    printf("enemies_killed: %d\n", enemies.countKilled());
+    printf("enemies_escaped: %d\n", enemies.countEscaped());
+    printf("wall_ms: %.2f\n", seconds * 1000.0);
+    printf("ticks_per_second: %.0f\n", seconds > 0.0 ? tick / seconds : 0.0);
+    printf("bullet_kernel: %s\n", getBulletKernelName());
+    if (hud) {      //only offscreen runs draw the hud
+        printf("hud_cache_hits: %llu\n", static_cast<unsigned long long>(hud->getCacheHits()));
+        printf("hud_rasterizations: %llu\n", static_cast<unsigned long long>(hud->getRasterizations()));
+    }
+}
 
-    delete enemyBulletManager;          //define everything needed for the restart
-    delete bulletManager;
-    bulletManager = new BulletManager(100, 0.1f);
-    enemyBulletManager = new EnemyBulletManager(200, 0.5f);
+void Game::paceFrame(Uint64 frameStart) const {       //without vsync, wait for the end of the display frame instead of a fixed sleep
+    PROFILE_ZONE("Game::paceFrame");
+    if (vsyncEnabled)
+        return;
 
-    // reload the current level file
-    std::string filename = getLevelFilename(currentLevel);
-    enemyManager->setupEnemies(renderer, playAreaX, playAreaWidth, screenHeight, filename.c_str());
-    enemyManager->setBulletManager(enemyBulletManager);
+    Uint64 spent = SDL_GetTicksNS() - frameStart;
+    if (spent < frameDurationNS)
+        SDL_DelayPrecise(frameDurationNS - spent);
+}
 
-    gameState->reset();
+void Game::setTickRate(int ticksPerSecond) {
+    if (ticksPerSecond > 0)
+        tickRate = ticksPerSecond;
 }
 
-void Game::handleGameOver() {        //sets the game over menu
-    gameState->setGameOver(true);
-    gameState->setPaused(true);
-    gameMenu->setPauseMode(true);
-    gameMenu->setGameOverMode(true);
+void Game::setMaxCatchUpTicks(int ticks) {
+    if (ticks > 0)
+        maxCatchUpTicks = ticks;
+}
 
+void Game::setSeed(Uint64 value) {
+    seed = value;
 }
-void Game::handleVictory() {         //sets the victory menu
-    gameState->setVictory(true);
-    gameState->setPaused(true);
-    gameMenu->setPauseMode(true);
-    gameMenu->setVictoryMode(true);
 
-    gameMenu->setCurrentLevel(currentLevel);
+void Game::setRecordPath(const std::string& path) {
+    recordPath = path;
 }
 
-void Game::handlePause() const {     //set the paused menu
-    gameState->setPaused(true);
-    gameMenu->setPauseMode(true);
+void Game::setProfilePath(const std::string& path) {
+    profilePath = path;
 }
 
-void Game::drawScore() const{
-    TTF_Font* scoreFont1 = TTF_OpenFont("assets/arcade.ttf", 24);
-	if (!scoreFont1){
-        printf("Couldn't load font");
-        return;
-    }
+void Game::handleEvents(const RenderSnapshot& snapshot) {     //the snapshot tells which menu is shown, the changes go to the simulation as commands
+    PROFILE_ZONE("Game::handleEvents");
+    SDL_Event event;
 
-    std::string scoreCount = "Score " + std::to_string(gameState->getScore());
-    SDL_Color black = { 0, 0, 0, 255 };
-    SDL_Surface* surface = TTF_RenderText_Blended(scoreFont1, scoreCount.c_str(), 0, black);
-
-    if (surface) {
-        SDL_Texture* texture = SDL_CreateTextureFromSurface(renderer, surface);
-        if (texture) {
-            SDL_FRect scoreRect;
-            scoreRect.x = playAreaX + 10.0f;
-            scoreRect.y = 10.0f;
-            scoreRect.w = static_cast<float>(surface->w);
-            scoreRect.h = static_cast<float>(surface->h);
-
-            SDL_RenderTexture(renderer, texture, nullptr, &scoreRect);
-            SDL_DestroyTexture(texture);
-        }
-        SDL_DestroySurface(surface);
-    }
-}
+    while (SDL_PollEvent(&event)) {         //events handled here
+        if (event.type == SDL_EVENT_QUIT)
+            running = false;
 
+        if (event.type == SDL_EVENT_WINDOW_RESIZED)
+            handleResize();
+        if (event.type == SDL_EVENT_RENDER_TARGETS_RESET || event.type == SDL_EVENT_RENDER_DEVICE_RESET)
+            playfield->invalidate();        //the cached layers have to be drawn again
 
+        if (event.type == SDL_EVENT_KEY_DOWN) {
+            if (event.key.key == SDLK_R)        //used to reset the level
+                postCommand({ WorldCommand::Type::Reset });
 
+            if (event.key.key == SDLK_ESCAPE)     //toggle the menu pause and stop the game from continuing
+                postCommand({ WorldCommand::Type::TogglePause });
 
-bool Game::loadLevelOrder(){
-    levelOrder.clear();
-    std::ifstream file("levelOrder.txt");
-    std::string currentLine;
+            if (event.key.key == SDLK_F9 && PROFILER_ENABLED)       //dump the profiler trace of the last moments
+                Profiler::writeChromeTrace(profilePath.c_str());
+        }
 
-    while (std::getline(file, currentLine)) {
-        if (currentLine.empty())
-            continue;
+        if (shownMenu != MenuState::None) {       //anything but menu start
+            int menuResult = gameMenu->handleEvents(event);
 
-        std::string level1, level2; 
-        std::getline(file, level1); 
-        std::getline(file, level2); 
-        levelOrder.push_back(level1);
-        levelOrder.push_back(level2);
+            if (menuResult == 1) {
+                if (snapshot.victory || snapshot.game_over)
+                    postCommand({ WorldCommand::Type::Reset });
+                else
+                    postCommand({ WorldCommand::Type::Resume });
+            }
+            else if (menuResult == 2) {
+                if (snapshot.victory && snapshot.level == 1)
+                    postCommand({ WorldCommand::Type::LoadLevel, 2 });
+            }
+            else if (menuResult == 3) {
+                if (snapshot.victory && snapshot.level == 2)
+                    postCommand({ WorldCommand::Type::LoadLevel, 1 });
+            }
+            else if (menuResult == 4) {
+                running = false;
+            }
+        }
     }
-    return true;
 }
 
-std::string Game::getLevelFilename(int level) const {
-    int index = level - 1;
+void Game::syncMenu(const RenderSnapshot& snapshot) {        //the menu follows the simulation state, only changed when that state does
+    MenuState state = MenuState::None;
+    if (snapshot.victory)
+        state = MenuState::Victory;
+    else if (snapshot.game_over)
+        state = MenuState::GameOver;
+    else if (snapshot.paused)
+        state = MenuState::Paused;
 
-    if (index >= 0 && index < levelOrder.size())
-        return levelOrder[index];
+    if (state == shownMenu)
+        return;
+    shownMenu = state;
 
-    return "";
+    gameMenu->setPauseMode(state != MenuState::None);
+    gameMenu->setGameOverMode(state == MenuState::GameOver);
+    gameMenu->setVictoryMode(state == MenuState::Victory);
+    if (state == MenuState::Victory)
+        gameMenu->setCurrentLevel(snapshot.level);
 }
 
+void Game::render(const RenderSnapshot& snapshot, float alpha) {       //renderers for the game, alpha is how far the frame is between the last two ticks
+    PROFILE_ZONE("Game::render");
+    SDL_SetRenderDrawColor(renderer, 0, 0, 0, 255);
+    SDL_RenderClear(renderer);
 
+    //only the play area is drawn, the rest of the screen stays the cleared black
+    playfield->drawBackground();
+    playfield->beginWorld();
 
-void Game::loadLevel(int level) {
-    // clamp level between 1 and 2
-    if (level < 1) level = 1;
-    if (level > 2) level = 2;
-    currentLevel = level;
+    //the world goes through the draw list, submitted grouped by texture and color
+    worldRenderer->draw(snapshot, *renderBatch, alpha);
+    renderBatch->flush(renderer);
 
-    // reset player position & health
-    if (player) {
-        player->resetPosition(initialPlayerX, initialPlayerY);
-        player->resetHealth();
-    }
+    drawScore(snapshot.score);
+    playfield->endWorld();
 
-    // recreate bullet managers
-    delete enemyBulletManager;
-    delete bulletManager;
-    bulletManager = new BulletManager(100, 0.1f);
-    enemyBulletManager = new EnemyBulletManager(200, 0.5f);
-
-    // load enemy file for chosen level
-    std::string filename = getLevelFilename(currentLevel);
-    enemyManager->setupEnemies(renderer, playAreaX, playAreaWidth, screenHeight, filename.c_str());
-    enemyManager->setBulletManager(enemyBulletManager);
+    if (shownMenu != MenuState::None)     //render menu in these cases
+        gameMenu->draw();
+}
 
-    // reset game state (clears victory/pause/game over)
-    gameState->reset();
-    gameMenu->setPauseMode(false);
-    gameMenu->setVictoryMode(false);
-    gameMenu->setGameOverMode(false);
+void Game::drawScore(int score) {       //the hud keeps the score texture until the score changes
+    PROFILE_ZONE("Game::drawScore");
+    hud->drawScore(score, playAreaX + 10.0f, 10.0f);
 }
 
 
 void Game::cleanup() {              //cleans every pointers and destroy any texture
-    delete player;
-    player = nullptr;
-    delete bulletManager;
-    bulletManager = nullptr;
-    delete enemyBulletManager;
-    enemyBulletManager = nullptr;
-    delete enemyManager;
-    enemyManager = nullptr;
-    delete gameState;
-    gameState = nullptr;
+    delete recorder;
+    recorder = nullptr;
+    delete world;
+    world = nullptr;
+    delete hud;
+    hud = nullptr;
+    delete renderBatch;
+    renderBatch = nullptr;
+    delete worldRenderer;
+    worldRenderer = nullptr;
     delete gameMenu;
     gameMenu = nullptr;
 
-    SDL_DestroyTexture(bgTexture);
-    bgTexture = nullptr;
+    delete playfield;
+    playfield = nullptr;
+    delete textures;        //after everything that holds a sprite, before the renderer
+    textures = nullptr;
     SDL_DestroyRenderer(renderer);
     renderer = nullptr;
     SDL_DestroyWindow(window);
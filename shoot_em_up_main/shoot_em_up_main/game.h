@@ -1,66 +1,95 @@
 #pragma once
 
 #include <SDL3/SDL.h>
-#include "entity.h"
-#include "bullet.h"
-#include "enemy.h"
+#include "world.h"
+#include "replay.h"
+#include "profiler.h"
 #include "menu.h"
-#include "gamestate.h"
+#include "hud.h"
+#include "renderbatch.h"
+#include "texturecache.h"
+#include "playfield.h"
+#include "keyboard.h"
+#include "launchoptions.h"
+#include "snapshot.h"
+#include "worldrenderer.h"
 #include <SDL3_image/SDL_image.h>
 #include <string>
 #include <fstream>
+#include <memory>
+#include <vector>
+#include <atomic>
+#include <mutex>
+#include <thread>
+
+enum class MenuState { None, Paused, Victory, GameOver };
 
 class Game {
 private:
 	SDL_Window* window;
 	SDL_Renderer* renderer;
-	SDL_Texture* bgTexture;
+	TextureCache* textures;
+	Playfield* playfield;
 	int screenWidth;
 	int screenHeight;
 	int playAreaX;
 	int playAreaWidth;
 
-	Entity* player;
-	BulletManager* bulletManager;
-	EnemyBulletManager* enemyBulletManager;
-	EnemyManager* enemyManager;
-	GameState* gameState;
+	World* world;				// the simulation, the play bounds only change through a Resize command
 	Menu* gameMenu;
-	float initialPlayerX;
-	float initialPlayerY;
+	Hud* hud;
+	RenderBatch* renderBatch;
+	WorldRenderer* worldRenderer;
 
 	bool running;
-	Uint64 lastTime;
-	int currentLevel;
-	std::vector<std::string> levelOrder;
+	int tickRate;				// simulation ticks per second, independent from the display rate
+	int maxCatchUpTicks;		// ticks simulated at most per frame after a hitch
+	bool vsyncEnabled;
+	Uint64 frameDurationNS;		// pacing target when vsync is not available
+	Uint64 seed;				// given to the world, a replay needs it to play the same game again
+	std::string recordPath;		// empty when the run is not recorded
+	std::string profilePath;	// where F9 writes the profiler trace
+
+	// simulation thread state, only touched by that thread once it runs
+	InputFrame currentInput;
+	Replay* recorder;			// only while recording
 
-	bool loadLevelOrder();
-	std::string getLevelFilename(int level) const;
-	void loadLevel(int level);
+	// shared between the two threads
+	std::atomic<bool> simulating;
+	TripleBuffer<RenderSnapshot> snapshots;
+	std::mutex commandMutex;
+	std::vector<WorldCommand> pendingCommands;		// requests from the main thread, applied between two ticks
+	InputFrame pendingInput;
+
+	// main thread state
+	MenuState shownMenu;
 
 	bool initSDL() const;
 	bool createWindow();
 	bool createRenderer();
 	void calculatePlayArea();
+	void handleResize();
 	bool loadResources();
 
 	void setupGameObjects();
-	void handleEvents();
-	void update(float dt);
-	void render();
-
-	void handleCollisions();
-	void checkBulletEnemyCollisions();
-	void checkPlayerEnemyCollisions();
-	void checkPlayerBulletCollisions();
-	void checkOffscreenEnemies();
-	bool checkCollision(const SDL_FRect& a, const SDL_FRect& b) const;
-
-	void resetGame();
-	void handleGameOver();
-	void handleVictory();
-	void handlePause() const;
-	void drawScore() const;
+	void setupRendering();
+	void handleEvents(const RenderSnapshot& snapshot);
+	void syncMenu(const RenderSnapshot& snapshot);
+	void render(const RenderSnapshot& snapshot, float alpha);
+	void paceFrame(Uint64 frameStart) const;
+
+	void postCommand(const WorldCommand& command);
+	void postInput(const InputFrame& input);
+	void applyCommands();
+	void simulationLoop();
+	void publishSnapshot(Uint64 tickTime);
+	void startRecording();
+	void stopRecording();
+	int runReplay(const LaunchOptions& options);
+	void renderHeadlessFrame();
+	void printRunStats(HeadlessResult result, Uint64 tick, float dt, Uint64 elapsed) const;
+
+	void drawScore(int score);
 
 	void cleanup();
 
@@ -72,4 +101,13 @@ public:
 	bool showMenu();
 	void run();
 
+	bool initializeHeadless(bool offscreen);
+	int runHeadless(const LaunchOptions& options);
+
+	void setTickRate(int ticksPerSecond);
+	void setMaxCatchUpTicks(int ticks);
+	void setSeed(Uint64 value);
+	void setRecordPath(const std::string& path);
+	void setProfilePath(const std::string& path);
+
 };
\ No newline at end of file
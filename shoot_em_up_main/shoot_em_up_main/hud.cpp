@@ -0,0 +1,71 @@
+#include "hud.h"
+
+Hud::Hud(SDL_Renderer* renderer) : renderer(renderer), font(nullptr), scoreText{ nullptr, 0.0f, 0.0f, 0, false }, cacheHits(0), rasterizations(0) {
+    if (!TTF_Init()) {      //reference counted, the menu also initializes it
+        printf("TTF_Init failed");
+        return;
+    }
+
+    font = TTF_OpenFont("assets/arcade.ttf", 24);
+    if (!font)
+        printf("Couldn't load font");
+}
+
+Hud::~Hud() {       //release the cached texture and the font
+    SDL_DestroyTexture(scoreText.texture);
+    scoreText.texture = nullptr;
+    TTF_CloseFont(font);
+    font = nullptr;
+    TTF_Quit();
+}
+
+bool Hud::rasterize(HudText& text, const std::string& str, SDL_Color color) {     //renders the string into the element's texture
+    if (!font)
+        return false;
+
+    SDL_Surface* surface = TTF_RenderText_Blended(font, str.c_str(), 0, color);
+    if (!surface)
+        return false;
+
+    SDL_Texture* texture = SDL_CreateTextureFromSurface(renderer, surface);
+    if (texture) {
+        SDL_DestroyTexture(text.texture);
+        text.texture = texture;
+        text.width = static_cast<float>(surface->w);
+        text.height = static_cast<float>(surface->h);
+    }
+    SDL_DestroySurface(surface);
+
+    rasterizations++;
+    return texture != nullptr;
+}
+
+void Hud::drawText(const HudText& text, float x, float y) const {
+    if (!text.texture)
+        return;
+
+    SDL_FRect destRect = { x, y, text.width, text.height };
+    SDL_RenderTexture(renderer, text.texture, nullptr, &destRect);
+}
+
+void Hud::drawScore(int score, float x, float y) {      //only renders the text again when the score has changed
+    if (!scoreText.valid || scoreText.value != score) {
+        SDL_Color black = { 0, 0, 0, 255 };
+        if (!rasterize(scoreText, "Score " + std::to_string(score), black))
+            return;
+        scoreText.value = score;
+        scoreText.valid = true;
+    }
+    else
+        cacheHits++;
+
+    drawText(scoreText, x, y);
+}
+
+Uint64 Hud::getCacheHits() const {
+    return cacheHits;
+}
+
+Uint64 Hud::getRasterizations() const {
+    return rasterizations;
+}
@@ -0,0 +1,39 @@
+#pragma once
+#include <SDL3/SDL.h>
+#include <SDL3_ttf/SDL_ttf.h>
+#include <string>
+
+// A single HUD element, its texture is kept until the value it shows changes
+struct HudText {
+    SDL_Texture* texture;
+    float width;
+    float height;
+    int value;
+    bool valid;     // false until the first rasterization
+};
+
+// Draws the in-game text (score), the font is opened once for the whole session
+class Hud {
+private:
+    SDL_Renderer* renderer;
+    TTF_Font* font;
+    HudText scoreText;
+
+    Uint64 cacheHits;           // frames drawn from the cached texture
+    Uint64 rasterizations;      // frames that had to render the text again
+
+    bool rasterize(HudText& text, const std::string& str, SDL_Color color);
+    void drawText(const HudText& text, float x, float y) const;
+
+public:
+    Hud(SDL_Renderer* renderer);
+    ~Hud();
+
+    Hud(const Hud&) = delete;
+    Hud& operator=(const Hud&) = delete;
+
+    void drawScore(int score, float x, float y);
+
+    Uint64 getCacheHits() const;
+    Uint64 getRasterizations() const;
+};
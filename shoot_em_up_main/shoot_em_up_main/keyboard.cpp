@@ -0,0 +1,14 @@
+#include "keyboard.h"
+
+InputFrame readKeyboardInput(const bool* keys) {      //directions not only with zqsd but with directional arrows
+    InputFrame input = {};
+    if (!keys)
+        return input;
+
+    input.up = keys[SDL_SCANCODE_UP] || keys[SDL_SCANCODE_W];
+    input.down = keys[SDL_SCANCODE_DOWN] || keys[SDL_SCANCODE_S];
+    input.left = keys[SDL_SCANCODE_LEFT] || keys[SDL_SCANCODE_A];
+    input.right = keys[SDL_SCANCODE_RIGHT] || keys[SDL_SCANCODE_D];
+    input.fire = keys[SDL_SCANCODE_SPACE];
+    return input;
+}
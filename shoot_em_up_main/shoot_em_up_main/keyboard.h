@@ -0,0 +1,6 @@
+#pragma once
+#include <SDL3/SDL.h>
+#include "input.h"
+
+// Maps the SDL keyboard state to the controls of a simulation tick
+InputFrame readKeyboardInput(const bool* keys);
@@ -0,0 +1,107 @@
+#include "launchoptions.h"
+#include "profiler.h"
+#include "seed.h"
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+
+LaunchOptions::LaunchOptions() : headless(false), offscreen(false), level(1), ticks(3600), tickRate(60), input(InputSource::Idle), seed(1) {
+}
+
+static bool readNumber(const char* text, long long& value) {      //the whole argument has to be a number
+    char* end = nullptr;
+    value = std::strtoll(text, &end, 10);
+    return end != text && *end == '\0';
+}
+
+bool parseLaunchOptions(int argc, char* argv[], LaunchOptions& options) {
+    for (int i = 1; i < argc; i++) {
+        const char* arg = argv[i];
+        const char* value = i + 1 < argc ? argv[i + 1] : nullptr;
+        long long number = 0;
+
+        if (std::strcmp(arg, "--headless") == 0) {
+            options.headless = true;
+        }
+        else if (std::strcmp(arg, "--offscreen") == 0) {       //implies headless
+            options.headless = true;
+            options.offscreen = true;
+        }
+        else if (std::strcmp(arg, "--level") == 0 && value) {
+            if (!readNumber(value, number) || number < 1 || number > 2) {
+                printf("Error: --level expects 1 or 2\n");
+                return false;
+            }
+            options.level = static_cast<int>(number);
+            i++;
+        }
+        else if (std::strcmp(arg, "--ticks") == 0 && value) {
+            if (!readNumber(value, number) || number < 1) {
+                printf("Error: --ticks expects a positive number\n");
+                return false;
+            }
+            options.ticks = static_cast<Uint64>(number);
+            i++;
+        }
+        else if (std::strcmp(arg, "--tick-rate") == 0 && value) {
+            if (!readNumber(value, number) || number < 1 || number > 1000) {
+                printf("Error: --tick-rate expects a number between 1 and 1000\n");
+                return false;
+            }
+            options.tickRate = static_cast<int>(number);
+            i++;
+        }
+        else if (std::strcmp(arg, "--input") == 0 && value) {
+            if (std::strcmp(value, "idle") == 0)
+                options.input = InputSource::Idle;
+            else if (std::strcmp(value, "fire") == 0)
+                options.input = InputSource::Fire;
+            else if (std::strncmp(value, "script:", 7) == 0 && value[7] != '\0') {
+                options.input = InputSource::Script;
+                options.scriptPath = value + 7;
+            }
+            else {
+                printf("Error: --input expects idle, fire or script:<path>\n");
+                return false;
+            }
+            i++;
+        }
+        else if (std::strcmp(arg, "--seed") == 0 && value) {
+            if (!parseSeed(value, options.seed)) {
+                printf("Error: --seed expects a whole number between 0 and 18446744073709551615\n");
+                return false;
+            }
+            i++;
+        }
+        else if (std::strcmp(arg, "--record") == 0 && value) {
+            options.recordPath = value;
+            i++;
+        }
+        else if (std::strcmp(arg, "--profile") == 0 && value) {
+            if (!PROFILER_ENABLED)
+                printf("Warning: the profiler is compiled out of this build, define ENABLE_PROFILER to get zones\n");
+            options.profilePath = value;
+            i++;
+        }
+        else if (std::strcmp(arg, "--replay") == 0 && value) {      //implies headless
+            options.headless = true;
+            options.replayPath = value;
+            i++;
+        }
+        else {
+            printf("Error: unknown or incomplete option %s\n", arg);
+            printUsage(argv[0]);
+            return false;
+        }
+    }
+
+    if (!options.recordPath.empty() && !options.replayPath.empty()) {
+        printf("Error: --record and --replay cannot be used together\n");
+        return false;
+    }
+    return true;
+}
+
+void printUsage(const char* program) {
+    printf("usage: %s [--headless | --offscreen] [--level 1|2] [--ticks N] [--tick-rate N] [--input idle|fire|script:<path>] [--seed N] [--record <path> | --replay <path>] [--profile <path>]\n", program);
+}
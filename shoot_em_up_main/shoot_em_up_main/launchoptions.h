@@ -0,0 +1,38 @@
+#pragma once
+#include <SDL3/SDL.h>
+#include <string>
+
+enum class InputSource {
+    Idle,       // no key held
+    Fire,       // fire held, no movement
+    Script      // replayed from a file, see InputScript
+};
+
+// Command line of the game. Without --headless the game starts as usual with its menu.
+struct LaunchOptions {
+    bool headless;
+    bool offscreen;             // headless but still drawing every tick with the software renderer
+    int level;
+    Uint64 ticks;               // headless runs stop after this many ticks at most
+    int tickRate;
+    InputSource input;
+    std::string scriptPath;
+    Uint64 seed;                // seed of the world's random sequence
+    std::string recordPath;     // the run is saved there as a replay when it ends
+    std::string replayPath;     // plays this replay instead, implies headless
+    std::string profilePath;    // the profiler trace is written there at exit
+
+    LaunchOptions();
+};
+
+bool parseLaunchOptions(int argc, char* argv[], LaunchOptions& options);
+void printUsage(const char* program);
+
+// Process exit status of a headless run
+enum class HeadlessResult {
+    Victory = 0,        // every enemy of the level is gone
+    Error = 1,          // bad command line or initialization failure
+    GameOver = 2,       // the player died
+    Timeout = 3,        // the tick limit was reached first
+    ReplayMismatch = 4  // a replay did not end with the score and health it recorded
+};
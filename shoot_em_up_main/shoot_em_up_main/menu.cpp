@@ -1,8 +1,8 @@
 #include "menu.h"
 #include <SDL3_image/SDL_image.h>
 
-Menu::Menu(SDL_Renderer* renderer, int winWidth, int winHeight)
-: renderer(renderer), font(nullptr), isPauseMenu(false), isVictoryMenu(false), isGameOverMenu(false), currentLevel(1), windowWidth(winWidth), windowHeight(winHeight) {
+Menu::Menu(SDL_Renderer* renderer, TextureCache* textures, int winWidth, int winHeight)
+: renderer(renderer), textures(textures), font(nullptr), isPauseMenu(false), isVictoryMenu(false), isGameOverMenu(false), currentLevel(1), windowWidth(winWidth), windowHeight(winHeight) {
     
     if (!TTF_Init()) {
         printf("TTF_Init failed");
@@ -70,55 +70,28 @@ Menu::Menu(SDL_Renderer* renderer, int winWidth, int winHeight)
 
 
     updateButtonPositions();
-    {
-        SDL_Surface* surface = IMG_Load("assets/title.png");
-        if (surface) {
-            titleTexture = SDL_CreateTextureFromSurface(renderer, surface);
-            if (titleTexture) {
-                titleWidth = surface->w;
-                titleHeight = surface->h;
-            }
-            SDL_DestroySurface(surface);
-        }
-    }
+    if (textures)
+        titleTexture = textures->load("assets/title.png");
 }
 
-Menu::~Menu() {     //destory the textures when the menu is closed
-    SDL_DestroyTexture(playButton.texture);
-    SDL_DestroyTexture(playButton.hoverTexture);
-
-    SDL_DestroyTexture(resumeButton.texture);
-    SDL_DestroyTexture(resumeButton.hoverTexture);
-
-    SDL_DestroyTexture(replayButton.texture);
-    SDL_DestroyTexture(replayButton.hoverTexture);
-
-    SDL_DestroyTexture(quitButton.texture);
-    SDL_DestroyTexture(quitButton.hoverTexture);
-
-    SDL_DestroyTexture(titleTexture);
+Menu::~Menu() {     //button and title sprites are shared with the texture cache, only the labels are owned here
+    clearTextCache();
     TTF_CloseFont(font);
     TTF_Quit();
 
 }
 
 void Menu::loadButtonTexture(Button& button, const char* normalPath, const char* hoverPath) {       //load every texture needed for the menu
-    SDL_Surface* surface = IMG_Load(normalPath);
-    if (surface) {
-        button.texture = SDL_CreateTextureFromSurface(renderer, surface);
-        SDL_DestroySurface(surface);
-        
-    }
-    else
+    if (!textures)
+        return;
+
+    button.texture = textures->load(normalPath);
+    if (!button.texture->IsValid())
         printf("Failed to load image");
 
     if (hoverPath) {        //load texture for the hover button
-        surface = IMG_Load(hoverPath);
-        if (surface) {
-            button.hoverTexture = SDL_CreateTextureFromSurface(renderer, surface);
-            SDL_DestroySurface(surface);
-        }
-        else
+        button.hoverTexture = textures->load(hoverPath);
+        if (!button.hoverTexture->IsValid())
             printf("Failed to load hover image ");
     }
 }
@@ -153,6 +126,7 @@ void Menu::setGameOverMode(bool isGameOver) {       //trigger game over menu
 void Menu::setWindowSize(int width, int height) {       //adjusts to the window's size
     windowWidth = width;
     windowHeight = height;
+    clearTextCache();
     updateButtonPositions();
 }
 
@@ -256,38 +230,57 @@ void Menu::update(float mouseX, float mouseY) {
     }
 }
 
-void Menu::drawText(const char* text, int x, int y, SDL_Color color) {          //draw every text needed
-    if (!font)
-        return;
+const CachedText* Menu::getCachedText(const char* text, SDL_Color color) {       //rasterize a label once, then reuse its texture and size
+    if (!font || !text)
+        return nullptr;
+
+    Uint32 packed = (Uint32(color.r) << 24) | (Uint32(color.g) << 16) | (Uint32(color.b) << 8) | color.a;
+    CachedTextKey key = { font, packed, text };
+
+    auto found = textCache.find(key);
+    if (found != textCache.end())
+        return &found->second;
 
     SDL_Surface* surface = TTF_RenderText_Blended(font, text, 0, color);
-    if (!surface) {
-        return;
-    }
+    if (!surface)
+        return nullptr;
 
     SDL_Texture* texture = SDL_CreateTextureFromSurface(renderer, surface);
-    if (!texture) {
-        SDL_DestroySurface(surface);
-        return;
-    }
+    CachedText entry = { texture, surface->w, surface->h };
+    SDL_DestroySurface(surface);
+    if (!texture)
+        return nullptr;
+
+    return &textCache.emplace(std::move(key), entry).first->second;
+}
 
+void Menu::clearTextCache() {       //destroys every cached label, they are rendered again on next use
+    for (auto& entry : textCache)
+        SDL_DestroyTexture(entry.second.texture);
+    textCache.clear();
+}
+
+void Menu::drawText(const char* text, int x, int y, SDL_Color color) {          //draw every text needed
+    const CachedText* cached = getCachedText(text, color);
+    if (cached)
+        drawCachedText(*cached, x, y);
+}
+
+void Menu::drawCachedText(const CachedText& label, int x, int y) {      //draws a label that was already looked up (and measured)
     SDL_FRect destRect;
     destRect.x = (float)x;
     destRect.y = (float)y;
-    destRect.w = (float)surface->w;
-    destRect.h = (float)surface->h;
+    destRect.w = (float)label.width;
+    destRect.h = (float)label.height;
 
-    SDL_RenderTexture(renderer, texture, NULL, &destRect);
-
-    SDL_DestroyTexture(texture);
-    SDL_DestroySurface(surface);
+    SDL_RenderTexture(renderer, label.texture, NULL, &destRect);
 }
 
 void Menu::drawButton(const Button& button) {           //draws evey button for the menu
-    SDL_Texture* currentTexture = button.isHovered && button.hoverTexture ? button.hoverTexture : button.texture;
+    const Sprite* current = button.isHovered && button.hoverTexture && button.hoverTexture->IsValid() ? button.hoverTexture.get() : button.texture.get();
 
-    if (currentTexture)
-        SDL_RenderTexture(renderer, currentTexture, nullptr, &button.rect);
+    if (current && current->IsValid())
+        current->Draw(renderer, &button.rect);
     else {
         if (button.isHovered)
             SDL_SetRenderDrawColor(renderer, button.hoverColor.r, button.hoverColor.g, button.hoverColor.b, button.hoverColor.a);
@@ -295,19 +288,12 @@ void Menu::drawButton(const Button& button) {           //draws evey button for
             SDL_SetRenderDrawColor(renderer, button.color.r, button.color.g, button.color.b, button.color.a);
         SDL_RenderFillRect(renderer, &button.rect);
 
-        if (font) {
-            SDL_Color tempColor = { 255, 255, 255, 255 };
-            SDL_Surface* tempSurface = TTF_RenderText_Blended(font, button.text, 0, tempColor);
-            if (tempSurface) {
-                int textW = tempSurface->w;
-                int textH = tempSurface->h;
-                SDL_DestroySurface(tempSurface);
-
-                int textX = (int)(button.rect.x + (button.rect.w - textW) / 2);
-                int textY = (int)(button.rect.y + (button.rect.h - textH) / 2);
-                SDL_Color textColor = { 255, 255, 255, 255 };
-                drawText(button.text, textX, textY, textColor);
-            }
+        SDL_Color textColor = { 255, 255, 255, 255 };
+        const CachedText* label = getCachedText(button.text, textColor);
+        if (label) {
+            int textX = (int)(button.rect.x + (button.rect.w - label->width) / 2);
+            int textY = (int)(button.rect.y + (button.rect.h - label->height) / 2);
+            drawCachedText(*label, textX, textY);
         }
     }
 }
@@ -336,35 +322,31 @@ void Menu::draw() {         //draws the menu
             else
                 title = "PAUSED";
 
-            SDL_Surface* tempSurface = TTF_RenderText_Blended(font, title, 0, titleColor);
-            if (tempSurface) {
-                int titleW = tempSurface->w;
-                SDL_DestroySurface(tempSurface);
+            const CachedText* label = getCachedText(title, titleColor);
+            if (label) {
                 int titleY = (int)(playButton.rect.y - 100);
-                drawText(title, (windowWidth - titleW) / 2, titleY, titleColor);
+                drawCachedText(*label, (windowWidth - label->width) / 2, titleY);
             }
         }
     }
     else {
 
-        if (titleTexture) {
+        if (titleTexture && titleTexture->IsValid()) {
             SDL_FRect titleRect;
             titleRect.w = 256.0f;
             titleRect.h = 128.0f;
             titleRect.x = (windowWidth - titleRect.w) / 2.0f;
             titleRect.y = (float)((int)(playButton.rect.y - 200));
-            SDL_RenderTexture(renderer, titleTexture, nullptr, &titleRect);
+            titleTexture->Draw(renderer, &titleRect);
         }
         else {
             if (font) {
                 SDL_Color titleColor = { 255, 255, 255, 255 };
                 const char* title = "BURGIRL";
-                SDL_Surface* tempSurface = TTF_RenderText_Blended(font, title, 0, titleColor);
-                if (tempSurface) {
-                    int titleW = tempSurface->w;
-                    SDL_DestroySurface(tempSurface);
+                const CachedText* label = getCachedText(title, titleColor);
+                if (label) {
                     int titleY = (int)(playButton.rect.y - 100);
-                    drawText(title, (windowWidth - titleW) / 2, titleY, titleColor);
+                    drawCachedText(*label, (windowWidth - label->width) / 2, titleY);
                 }
             }
         }
@@ -3,6 +3,9 @@
 #include <SDL3_ttf/SDL_ttf.h>
 #include <SDL3_image/SDL_image.h>
 #include <string>
+#include <unordered_map>
+#include <memory>
+#include "texturecache.h"
 
 enum class Button_Type {
     Play,
@@ -19,16 +22,44 @@ struct Button {
     SDL_Color color;     // Button color
     SDL_Color hoverColor; // Color when mouse is over it
     bool isHovered;      // Is mouse currently over this button?
+    std::shared_ptr<Sprite> texture;
+    std::shared_ptr<Sprite> hoverTexture;
+
+
+};
+
+// A label already rendered to a texture, with its measured size
+struct CachedText {
     SDL_Texture* texture;
-    SDL_Texture* hoverTexture;
+    int width;
+    int height;
+};
 
+// What a label is rasterized with, the color packed as 0xRRGGBBAA
+struct CachedTextKey {
+    TTF_Font* font;
+    Uint32 color;
+    std::string text;       // labels are short, they fit in the string without allocating
+
+    bool operator==(const CachedTextKey& other) const {
+        return font == other.font && color == other.color && text == other.text;
+    }
+};
 
+struct CachedTextKeyHash {
+    size_t operator()(const CachedTextKey& key) const {
+        size_t hash = std::hash<std::string>()(key.text);
+        hash ^= std::hash<const void*>()(key.font) + 0x9e3779b9 + (hash << 6) + (hash >> 2);
+        hash ^= std::hash<Uint32>()(key.color) + 0x9e3779b9 + (hash << 6) + (hash >> 2);
+        return hash;
+    }
 };
 
 // Menu class to handle the main menu
 class Menu {
 private:
     SDL_Renderer* renderer;
+    TextureCache* textures;
     TTF_Font* font;
     Button playButton;
     Button quitButton;
@@ -44,19 +75,23 @@ private:
     int windowHeight;     // Current window height
 
     // members for title image
-    SDL_Texture* titleTexture;
-    int titleWidth;
-    int titleHeight;
+    std::shared_ptr<Sprite> titleTexture;
+
+    // rasterized labels keyed by font, text and color
+    std::unordered_map<CachedTextKey, CachedText, CachedTextKeyHash> textCache;
 
     bool mouseOverButton(const Button& button, float mouseX, float mouseY) const;
     void drawButton(const Button& button);
     void drawText(const char* text, int x, int y, SDL_Color color);
+    void drawCachedText(const CachedText& label, int x, int y);
+    const CachedText* getCachedText(const char* text, SDL_Color color);
+    void clearTextCache();
     void updateButtonPositions(); // Recalculate button positions
 
     void loadButtonTexture(Button& button, const char* normalPath, const char* hoverPath = nullptr);
 
 public:
-    Menu(SDL_Renderer* renderer, int winWidth = 800, int winHeight = 600);
+    Menu(SDL_Renderer* renderer, TextureCache* textures, int winWidth = 800, int winHeight = 600);
     ~Menu();
 
     int handleEvents(SDL_Event& event);
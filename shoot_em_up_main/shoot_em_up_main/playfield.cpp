@@ -0,0 +1,81 @@
+#include "playfield.h"
+#include <cstdio>
+
+Playfield::Playfield(SDL_Renderer* renderer, std::shared_ptr<Sprite> background)
+: renderer(renderer), background(background), backgroundLayer(nullptr), area{ 0, 0, 0, 0 }, screenWidth(0), screenHeight(0), dirty(true) {
+}
+
+Playfield::~Playfield() {
+    SDL_DestroyTexture(backgroundLayer);
+    backgroundLayer = nullptr;
+}
+
+void Playfield::setArea(int x, int y, int width, int height, int screenW, int screenH) {       //the layers are rebuilt only if something changed
+    if (x == area.x && y == area.y && width == area.w && height == area.h && screenW == screenWidth && screenH == screenHeight && backgroundLayer)
+        return;
+
+    if (width != area.w || height != area.h) {
+        SDL_DestroyTexture(backgroundLayer);
+        backgroundLayer = nullptr;
+    }
+    area = { x, y, width, height };
+    screenWidth = screenW;
+    screenHeight = screenH;
+    dirty = true;
+}
+
+void Playfield::invalidate() {
+    dirty = true;
+}
+
+bool Playfield::rebuildBackground() {       //scale the visible part of the background into the layer once
+    if (!renderer || !background || !background->IsValid() || area.w <= 0 || area.h <= 0 || screenWidth <= 0 || screenHeight <= 0)
+        return false;
+
+    if (!backgroundLayer) {
+        backgroundLayer = SDL_CreateTexture(renderer, SDL_PIXELFORMAT_ARGB8888, SDL_TEXTUREACCESS_TARGET, area.w, area.h);
+        if (!backgroundLayer) {
+            fprintf(stderr, "Error creating background layer\n");
+            return false;
+        }
+        SDL_SetTextureBlendMode(backgroundLayer, SDL_BLENDMODE_NONE);      //opaque, no blending when copied every frame
+    }
+
+    //same framing as before: the background stretched over the whole screen, only the play area part kept
+    const SDL_FRect& full = background->GetSource();
+    SDL_FRect src;
+    src.x = full.x + full.w * area.x / screenWidth;
+    src.y = full.y + full.h * area.y / screenHeight;
+    src.w = full.w * area.w / screenWidth;
+    src.h = full.h * area.h / screenHeight;
+
+    SDL_Texture* previousTarget = SDL_GetRenderTarget(renderer);
+    SDL_SetRenderTarget(renderer, backgroundLayer);
+    SDL_SetRenderDrawColor(renderer, 0, 0, 0, 255);
+    SDL_RenderClear(renderer);
+    SDL_RenderTexture(renderer, background->GetTexture(), &src, nullptr);
+    SDL_SetRenderTarget(renderer, previousTarget);
+
+    dirty = false;
+    return true;
+}
+
+void Playfield::drawBackground() {
+    if (dirty && !rebuildBackground())
+        return;
+
+    SDL_FRect dst = { static_cast<float>(area.x), static_cast<float>(area.y), static_cast<float>(area.w), static_cast<float>(area.h) };
+    SDL_RenderTexture(renderer, backgroundLayer, nullptr, &dst);
+}
+
+void Playfield::beginWorld() {
+    SDL_SetRenderClipRect(renderer, &area);
+}
+
+void Playfield::endWorld() {
+    SDL_SetRenderClipRect(renderer, nullptr);
+}
+
+const SDL_Rect& Playfield::getArea() const {
+    return area;
+}
@@ -0,0 +1,36 @@
+#pragma once
+#include <SDL3/SDL.h>
+#include <memory>
+#include "Sprite.h"
+
+// Static layers of the game screen. The part of the background visible in the play area is
+// pre-scaled once into a render target and the world is clipped to the play area, so nothing
+// is drawn (then painted over) outside of it. The layer is only rebuilt when the area changes.
+class Playfield {
+private:
+    SDL_Renderer* renderer;
+    std::shared_ptr<Sprite> background;
+    SDL_Texture* backgroundLayer;       // play area sized render target
+    SDL_Rect area;
+    int screenWidth;
+    int screenHeight;
+    bool dirty;
+
+    bool rebuildBackground();
+
+public:
+    Playfield(SDL_Renderer* renderer, std::shared_ptr<Sprite> background);
+    ~Playfield();
+
+    Playfield(const Playfield&) = delete;
+    Playfield& operator=(const Playfield&) = delete;
+
+    void setArea(int x, int y, int width, int height, int screenW, int screenH);
+    void invalidate();      // render targets were lost (device reset), redraw the layers on next use
+
+    void drawBackground();
+    void beginWorld();      // clip everything that follows to the play area
+    void endWorld();
+
+    const SDL_Rect& getArea() const;
+};
@@ -0,0 +1,133 @@
+#include "renderbatch.h"
+#include <algorithm>
+
+RenderBatch::RenderBatch() : drawCalls(0) {
+}
+
+void RenderBatch::addTexture(SDL_Texture* texture, const SDL_FRect& dst, RenderLayer layer, float alpha) {
+    addTexture(texture, { 0.0f, 0.0f, 1.0f, 1.0f }, dst, layer, alpha);
+}
+
+void RenderBatch::addTexture(SDL_Texture* texture, const SDL_FRect& uv, const SDL_FRect& dst, RenderLayer layer, float alpha) {     //queue a textured quad, alpha modulates the texture
+    if (!texture)
+        return;
+
+    SDL_BlendMode blend = SDL_BLENDMODE_BLEND;
+    SDL_GetTextureBlendMode(texture, &blend);
+    quads.push_back({ layer, blend, texture, uv, dst, { 1.0f, 1.0f, 1.0f, alpha } });
+}
+
+void RenderBatch::addFillRect(const SDL_FRect& rect, SDL_Color color, RenderLayer layer, RectOrder order) {
+    rects.push_back({ layer, order, true, color, rect });
+}
+
+void RenderBatch::addOutlineRect(const SDL_FRect& rect, SDL_Color color, RenderLayer layer, RectOrder order) {
+    rects.push_back({ layer, order, false, color, rect });
+}
+
+static Uint32 packColor(SDL_Color color) {
+    return (static_cast<Uint32>(color.r) << 24) | (static_cast<Uint32>(color.g) << 16) | (static_cast<Uint32>(color.b) << 8) | color.a;
+}
+
+size_t RenderBatch::submitQuads(SDL_Renderer* renderer, size_t first, RenderLayer layer) {     //one geometry call per texture of the layer
+    size_t i = first;
+    while (i < quads.size() && quads[i].layer == layer) {
+        SDL_Texture* texture = quads[i].texture;
+        SDL_BlendMode blend = quads[i].blend;
+
+        vertices.clear();
+        indices.clear();
+        for (; i < quads.size() && quads[i].layer == layer && quads[i].texture == texture && quads[i].blend == blend; i++) {
+            const SDL_FRect& r = quads[i].dst;
+            const SDL_FRect& t = quads[i].uv;
+            const SDL_FColor& c = quads[i].color;
+            int base = static_cast<int>(vertices.size());
+            vertices.push_back({ { r.x, r.y }, c, { t.x, t.y } });
+            vertices.push_back({ { r.x + r.w, r.y }, c, { t.x + t.w, t.y } });
+            vertices.push_back({ { r.x + r.w, r.y + r.h }, c, { t.x + t.w, t.y + t.h } });
+            vertices.push_back({ { r.x, r.y + r.h }, c, { t.x, t.y + t.h } });
+
+            indices.push_back(base);
+            indices.push_back(base + 1);
+            indices.push_back(base + 2);
+            indices.push_back(base);
+            indices.push_back(base + 2);
+            indices.push_back(base + 3);
+        }
+
+        SDL_SetTextureBlendMode(texture, blend);
+        SDL_RenderGeometry(renderer, texture, vertices.data(), static_cast<int>(vertices.size()), indices.data(), static_cast<int>(indices.size()));
+        drawCalls++;
+    }
+    return i;
+}
+
+size_t RenderBatch::submitRects(SDL_Renderer* renderer, size_t first, RenderLayer layer) {     //one call per kind and color, rects are sorted by them inside an order
+    size_t i = first;
+    while (i < rects.size() && rects[i].layer == layer) {
+        bool filled = rects[i].filled;
+        SDL_Color color = rects[i].color;
+
+        runRects.clear();
+        for (; i < rects.size() && rects[i].layer == layer && rects[i].filled == filled && packColor(rects[i].color) == packColor(color); i++)
+            runRects.push_back(rects[i].rect);
+
+        SDL_SetRenderDrawColor(renderer, color.r, color.g, color.b, color.a);
+        if (filled)
+            SDL_RenderFillRects(renderer, runRects.data(), static_cast<int>(runRects.size()));
+        else
+            SDL_RenderRects(renderer, runRects.data(), static_cast<int>(runRects.size()));
+        drawCalls++;
+    }
+    return i;
+}
+
+void RenderBatch::flush(SDL_Renderer* renderer) {       //sort the frame by layer, quads by texture too, and submit it
+    drawCalls = 0;
+    if (!renderer) {
+        clear();
+        return;
+    }
+
+    //stable so that quads sharing a texture keep the order they were added in
+    std::stable_sort(quads.begin(), quads.end(), [](const Quad& a, const Quad& b) {
+        if (a.layer != b.layer)
+            return a.layer < b.layer;
+        if (a.blend != b.blend)
+            return a.blend < b.blend;
+        return a.texture < b.texture;
+    });
+    //rects overlap (a health bar over its background), the order key keeps what goes on top after what it covers
+    std::stable_sort(rects.begin(), rects.end(), [](const ColorRect& a, const ColorRect& b) {
+        if (a.layer != b.layer)
+            return a.layer < b.layer;
+        if (a.order != b.order)
+            return a.order < b.order;
+        if (a.filled != b.filled)
+            return a.filled > b.filled;
+        return packColor(a.color) < packColor(b.color);
+    });
+
+    SDL_BlendMode previousBlend = SDL_BLENDMODE_NONE;
+    SDL_GetRenderDrawBlendMode(renderer, &previousBlend);
+    SDL_SetRenderDrawBlendMode(renderer, SDL_BLENDMODE_BLEND);
+
+    size_t q = 0;
+    size_t r = 0;
+    for (int layer = 0; layer < static_cast<int>(RenderLayer::Count); layer++) {
+        q = submitQuads(renderer, q, static_cast<RenderLayer>(layer));
+        r = submitRects(renderer, r, static_cast<RenderLayer>(layer));
+    }
+
+    SDL_SetRenderDrawBlendMode(renderer, previousBlend);
+    clear();
+}
+
+void RenderBatch::clear() {
+    quads.clear();
+    rects.clear();
+}
+
+int RenderBatch::getDrawCalls() const {
+    return drawCalls;
+}
@@ -0,0 +1,74 @@
+#pragma once
+#include <SDL3/SDL.h>
+#include <vector>
+
+// Draw order of the game world, lower layers are submitted first
+enum class RenderLayer {
+    Enemies,
+    Player,
+    PlayerBullets,
+    EnemyBullets,
+    Count
+};
+
+// Draw order of the rects inside a layer: every background, then every fill, then every outline,
+// so a health bar's fill lands on its background whatever the number of bars
+enum class RectOrder {
+    Background,
+    Fill,
+    Outline
+};
+
+// Position between the previous and the current simulation tick, used to draw between ticks
+inline SDL_FRect interpolateRect(const SDL_FRect& previous, const SDL_FRect& current, float alpha) {
+    return { previous.x + (current.x - previous.x) * alpha, previous.y + (current.y - previous.y) * alpha, current.w, current.h };
+}
+
+// Frame draw list: collects textured quads and colored rects, then submits the quads grouped by texture
+// so the number of draw calls follows the number of distinct textures. Rects are grouped by order, kind
+// and color, one call for each color of each order.
+class RenderBatch {
+private:
+    struct Quad {
+        RenderLayer layer;
+        SDL_BlendMode blend;
+        SDL_Texture* texture;
+        SDL_FRect uv;       // normalized source region, atlas sprites only use part of the texture
+        SDL_FRect dst;
+        SDL_FColor color;
+    };
+
+    struct ColorRect {
+        RenderLayer layer;
+        RectOrder order;
+        bool filled;
+        SDL_Color color;
+        SDL_FRect rect;
+    };
+
+    std::vector<Quad> quads;
+    std::vector<ColorRect> rects;
+
+    // scratch buffers kept between frames
+    std::vector<SDL_Vertex> vertices;
+    std::vector<int> indices;
+    std::vector<SDL_FRect> runRects;
+
+    int drawCalls;
+
+    size_t submitQuads(SDL_Renderer* renderer, size_t first, RenderLayer layer);
+    size_t submitRects(SDL_Renderer* renderer, size_t first, RenderLayer layer);
+
+public:
+    RenderBatch();
+
+    void addTexture(SDL_Texture* texture, const SDL_FRect& dst, RenderLayer layer, float alpha = 1.0f);
+    void addTexture(SDL_Texture* texture, const SDL_FRect& uv, const SDL_FRect& dst, RenderLayer layer, float alpha = 1.0f);
+    void addFillRect(const SDL_FRect& rect, SDL_Color color, RenderLayer layer, RectOrder order = RectOrder::Fill);
+    void addOutlineRect(const SDL_FRect& rect, SDL_Color color, RenderLayer layer, RectOrder order = RectOrder::Outline);
+
+    void flush(SDL_Renderer* renderer);
+    void clear();
+
+    int getDrawCalls() const;       // calls issued by the last flush
+};
@@ -1,11 +1,34 @@
 #include "game.h"
 
-int main(int argc, char* argv[]) {
-    Game game;
+static int runGame(Game& game, const LaunchOptions& options) {
+    if (options.headless) {     //no window and no menu, see the README for the exit status
+        if (!game.initializeHeadless(options.offscreen))
+            return static_cast<int>(HeadlessResult::Error);
+        return game.runHeadless(options);
+    }
+
     if (!game.initialize()) 
         return 1;
     if (!game.showMenu()) 
         return 0;
     game.run();
     return 0;
-}
\ No newline at end of file
+}
+
+int main(int argc, char* argv[]) {
+    LaunchOptions options;
+    if (!parseLaunchOptions(argc, argv, options))
+        return static_cast<int>(HeadlessResult::Error);
+
+    Game game;
+    game.setTickRate(options.tickRate);
+    game.setSeed(options.seed);
+    game.setRecordPath(options.recordPath);
+    if (!options.profilePath.empty())
+        game.setProfilePath(options.profilePath);
+
+    int status = runGame(game, options);
+    if (!options.profilePath.empty())       //every thread has stopped, the trace is complete
+        Profiler::writeChromeTrace(options.profilePath.c_str());
+    return status;
+}
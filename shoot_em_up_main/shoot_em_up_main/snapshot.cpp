@@ -0,0 +1,37 @@
+#include "snapshot.h"
+
+void captureSnapshot(const World& world, Uint64 tickTime, RenderSnapshot& snapshot) {      //the vectors keep their capacity from one snapshot to the next
+    const Entity& player = world.getPlayer();
+    snapshot.tick = world.getTick();
+    snapshot.tick_time = tickTime;
+    snapshot.player = { player.getPrevRect(), player.getRect(), player.getHealth(), player.getMaxHealth(), player.getInvulnerableTimer() };
+
+    snapshot.enemies.clear();
+    world.getEntities().forEach(COMPONENT_TRANSFORM | COMPONENT_HEALTH | COMPONENT_KIND, [&](const Archetype& enemies) {
+        for (int e = 0; e < enemies.count; e++) {
+            if (enemies.health[e] > 0)
+                snapshot.enemies.push_back({ enemies.getPrevRect(e), enemies.getRect(e), enemies.health[e], enemies.max_health[e], enemies.type[e] });
+        }
+    });
+    snapshot.bullets.clear();
+    const PlayerBulletManager& bulletManager = world.getPlayerBullets();
+    const BulletColumns& bullets = bulletManager.getBullets();
+    for (int i = 0; i < bulletManager.getCount(); i++) {
+        if (bullets.isActive(i))
+            snapshot.bullets.push_back({ bullets.getPrevRect(i), bullets.getRect(i) });
+    }
+    snapshot.enemy_bullets.clear();
+    const EnemyBulletManager& enemyBulletManager = world.getEnemyBullets();
+    const BulletColumns& enemyBullets = enemyBulletManager.getBullets();
+    for (int i = 0; i < enemyBulletManager.getCount(); i++) {
+        if (enemyBullets.isActive(i))
+            snapshot.enemy_bullets.push_back({ enemyBullets.getPrevRect(i), enemyBullets.getRect(i) });
+    }
+
+    const GameState& state = world.getState();
+    snapshot.score = state.getScore();
+    snapshot.level = world.getLevel();
+    snapshot.paused = state.isPaused();
+    snapshot.game_over = state.isGameOver();
+    snapshot.victory = state.isVictory();
+}
@@ -0,0 +1,81 @@
+#pragma once
+#include <SDL3/SDL.h>
+#include <atomic>
+#include <vector>
+#include "world.h"
+
+// What the render thread needs from one simulation tick, copied out so it never touches live objects.
+// prev is the rect at the tick before, for interpolation.
+struct PlayerView {
+    SDL_FRect prev;
+    SDL_FRect rect;
+    int health;
+    int max_health;
+    float invulnerable_timer;
+};
+
+struct EnemyView {
+    SDL_FRect prev;
+    SDL_FRect rect;
+    int health;
+    int max_health;
+    EnemyType type;
+};
+
+struct BulletView {
+    SDL_FRect prev;
+    SDL_FRect rect;
+};
+
+struct RenderSnapshot {
+    Uint64 tick;
+    Uint64 tick_time;       // SDL_GetTicksNS() of the tick this snapshot shows
+    PlayerView player;
+    std::vector<EnemyView> enemies;
+    std::vector<BulletView> bullets;
+    std::vector<BulletView> enemy_bullets;
+    int score;
+    int level;
+    bool paused;
+    bool game_over;
+    bool victory;
+};
+
+// Copies what the renderer needs out of the world, tick_time is the SDL_GetTicksNS() of that tick
+void captureSnapshot(const World& world, Uint64 tickTime, RenderSnapshot& snapshot);
+
+// Lock-free single producer / single consumer triple buffer. The writer always has a slot to fill,
+// the reader always has a complete slot to read, and publishing just swaps indices.
+template <typename T>
+class TripleBuffer {
+private:
+    static constexpr unsigned fresh_bit = 4;
+    static constexpr unsigned index_mask = 3;
+
+    T slots[3];
+    std::atomic<unsigned> middle;   // slot between writer and reader, fresh_bit set when not read yet
+    unsigned back;                  // owned by the writer
+    unsigned front;                 // owned by the reader
+
+public:
+    TripleBuffer() : middle(1), back(0), front(2) {}
+
+    T& writeBuffer() {
+        return slots[back];
+    }
+
+    void publish() {        //hand the written slot over, take the previous middle slot to write next
+        back = middle.exchange(back | fresh_bit, std::memory_order_acq_rel) & index_mask;
+    }
+
+    bool update() {         //take the newest published slot if there is one, false when nothing new
+        if (!(middle.load(std::memory_order_acquire) & fresh_bit))
+            return false;
+        front = middle.exchange(front, std::memory_order_acq_rel) & index_mask;
+        return true;
+    }
+
+    const T& readBuffer() const {
+        return slots[front];
+    }
+};
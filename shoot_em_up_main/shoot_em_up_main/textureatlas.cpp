@@ -0,0 +1,183 @@
+#include "textureatlas.h"
+#include <SDL3_image/SDL_image.h>
+#include <algorithm>
+#include <cstdio>
+
+TextureAtlas::TextureAtlas(int padding) : padding(std::max(padding, 2)) {       //room for the gutters of two neighbours
+}
+
+TextureAtlas::~TextureAtlas() {
+    clear();
+}
+
+static void blitEdges(SDL_Surface* image, SDL_Surface* page, int x, int y) {       //copy the outer pixels of the image one pixel further out
+    int w = image->w;
+    int h = image->h;
+    const SDL_Rect sources[8] = {
+        { 0, 0, w, 1 }, { 0, h - 1, w, 1 }, { 0, 0, 1, h }, { w - 1, 0, 1, h },
+        { 0, 0, 1, 1 }, { w - 1, 0, 1, 1 }, { 0, h - 1, 1, 1 }, { w - 1, h - 1, 1, 1 }
+    };
+    const SDL_Rect targets[8] = {
+        { x, y - 1, w, 1 }, { x, y + h, w, 1 }, { x - 1, y, 1, h }, { x + w, y, 1, h },
+        { x - 1, y - 1, 1, 1 }, { x + w, y - 1, 1, 1 }, { x - 1, y + h, 1, 1 }, { x + w, y + h, 1, 1 }
+    };
+    for (int i = 0; i < 8; i++)
+        SDL_BlitSurface(image, &sources[i], page, &targets[i]);
+}
+
+bool TextureAtlas::buildFromDirectory(SDL_Renderer* renderer, const char* directory, int maxPageSize) {      //packs every png of a directory, keyed "directory/name.png"
+    int count = 0;
+    char** names = SDL_GlobDirectory(directory, "*.png", 0, &count);
+    if (!names) {
+        fprintf(stderr, "Error listing atlas directory\n");
+        return false;
+    }
+
+    std::vector<std::string> paths;
+    for (int i = 0; i < count; i++)
+        paths.push_back(std::string(directory) + "/" + names[i]);
+    SDL_free(names);
+
+    std::sort(paths.begin(), paths.end());      //same layout on every run
+    return build(renderer, paths, maxPageSize);
+}
+
+bool TextureAtlas::build(SDL_Renderer* renderer, const std::vector<std::string>& paths, int maxPageSize) {     //load the images and pack them on shelves
+    clear();
+    if (!renderer)
+        return false;
+
+    int maxTexture = static_cast<int>(SDL_GetNumberProperty(SDL_GetRendererProperties(renderer), SDL_PROP_RENDERER_MAX_TEXTURE_SIZE_NUMBER, maxPageSize));
+    int pageSize = std::min(maxPageSize, maxTexture);
+
+    struct Placement {
+        std::string path;
+        SDL_Surface* surface;
+        int page;
+        int x;
+        int y;
+    };
+
+    std::vector<Placement> images;
+    for (const auto& path : paths) {
+        SDL_Surface* loaded = IMG_Load(path.c_str());
+        if (!loaded) {
+            fprintf(stderr, "Error loading atlas image\n");
+            continue;
+        }
+        SDL_Surface* surface = SDL_ConvertSurface(loaded, SDL_PIXELFORMAT_RGBA32);
+        SDL_DestroySurface(loaded);
+        if (!surface)
+            continue;
+
+        if (surface->w + padding * 2 > pageSize || surface->h + padding * 2 > pageSize) {     //too big, stays a texture of its own
+            SDL_DestroySurface(surface);
+            continue;
+        }
+        images.push_back({ path, surface, 0, 0, 0 });
+    }
+
+    //tallest first so each shelf wastes as little height as possible
+    std::stable_sort(images.begin(), images.end(), [](const Placement& a, const Placement& b) {
+        return a.surface->h > b.surface->h;
+    });
+
+    std::vector<int> pageHeights;
+    int page = 0;
+    int shelfX = padding;
+    int shelfY = padding;
+    int shelfHeight = 0;
+    for (auto& image : images) {
+        int w = image.surface->w;
+        int h = image.surface->h;
+
+        if (shelfX + w + padding > pageSize) {      //next shelf
+            shelfY += shelfHeight + padding;
+            shelfX = padding;
+            shelfHeight = 0;
+        }
+        if (shelfY + h + padding > pageSize) {      //next page
+            pageHeights.push_back(shelfY);
+            page++;
+            shelfX = padding;
+            shelfY = padding;
+            shelfHeight = 0;
+        }
+
+        image.page = page;
+        image.x = shelfX;
+        image.y = shelfY;
+        shelfX += w + padding;
+        shelfHeight = std::max(shelfHeight, h);
+    }
+    if (!images.empty())
+        pageHeights.push_back(shelfY + shelfHeight + padding);
+
+    //compose every page in memory, then upload it once
+    bool ok = true;
+    for (int p = 0; p < static_cast<int>(pageHeights.size()); p++) {
+        SDL_Surface* pageSurface = SDL_CreateSurface(pageSize, pageHeights[p], SDL_PIXELFORMAT_RGBA32);
+        SDL_Texture* texture = nullptr;
+        if (pageSurface) {
+            SDL_FillSurfaceRect(pageSurface, nullptr, 0);
+            for (const auto& image : images) {
+                if (image.page != p)
+                    continue;
+                SDL_Rect dst = { image.x, image.y, image.surface->w, image.surface->h };
+                SDL_SetSurfaceBlendMode(image.surface, SDL_BLENDMODE_NONE);
+                SDL_BlitSurface(image.surface, nullptr, pageSurface, &dst);
+                blitEdges(image.surface, pageSurface, image.x, image.y);
+            }
+            texture = SDL_CreateTextureFromSurface(renderer, pageSurface);
+            SDL_DestroySurface(pageSurface);
+        }
+
+        if (!texture) {
+            fprintf(stderr, "Error creating atlas page\n");
+            ok = false;
+        }
+        else {
+            //linear like the separate textures were, the gutters keep the neighbours out of the filter
+            SDL_SetTextureBlendMode(texture, SDL_BLENDMODE_BLEND);
+            SDL_SetTextureScaleMode(texture, SDL_SCALEMODE_LINEAR);
+        }
+        pages.push_back(texture);
+    }
+
+    for (auto& image : images) {
+        if (pages[image.page]) {
+            SDL_FRect rect = { static_cast<float>(image.x), static_cast<float>(image.y), static_cast<float>(image.surface->w), static_cast<float>(image.surface->h) };
+            regions[image.path] = { image.page, rect };
+        }
+        SDL_DestroySurface(image.surface);
+    }
+    return ok;
+}
+
+void TextureAtlas::clear() {
+    for (SDL_Texture* page : pages)
+        SDL_DestroyTexture(page);
+    pages.clear();
+    regions.clear();
+}
+
+const AtlasRegion* TextureAtlas::findRegion(const std::string& path) const {
+    auto found = regions.find(path);
+    if (found == regions.end())
+        return nullptr;
+    return &found->second;
+}
+
+SDL_Texture* TextureAtlas::getPage(int page) const {
+    if (page < 0 || page >= static_cast<int>(pages.size()))
+        return nullptr;
+    return pages[page];
+}
+
+int TextureAtlas::getPageCount() const {
+    return static_cast<int>(pages.size());
+}
+
+int TextureAtlas::getRegionCount() const {
+    return static_cast<int>(regions.size());
+}
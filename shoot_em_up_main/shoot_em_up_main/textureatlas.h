@@ -0,0 +1,36 @@
+#pragma once
+#include <SDL3/SDL.h>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+// Named sub-rectangle of an atlas page
+struct AtlasRegion {
+    int page;
+    SDL_FRect rect;
+};
+
+// Packs many small images into a few large textures so sprites can share one texture.
+// Images are placed on shelves (rows sorted by height), the manifest maps each path to its region.
+class TextureAtlas {
+private:
+    std::vector<SDL_Texture*> pages;
+    std::unordered_map<std::string, AtlasRegion> regions;
+    int padding;        // pixels between regions, at least 2: the pixel next to a region repeats its edge so linear filtering never reaches a neighbour
+
+public:
+    TextureAtlas(int padding = 2);
+    ~TextureAtlas();
+
+    TextureAtlas(const TextureAtlas&) = delete;
+    TextureAtlas& operator=(const TextureAtlas&) = delete;
+
+    bool build(SDL_Renderer* renderer, const std::vector<std::string>& paths, int maxPageSize = 2048);
+    bool buildFromDirectory(SDL_Renderer* renderer, const char* directory, int maxPageSize = 2048);
+    void clear();
+
+    const AtlasRegion* findRegion(const std::string& path) const;
+    SDL_Texture* getPage(int page) const;
+    int getPageCount() const;
+    int getRegionCount() const;
+};
@@ -0,0 +1,54 @@
+#include "texturecache.h"
+#include "profiler.h"
+
+TextureCache::TextureCache(SDL_Renderer* renderer) : renderer(renderer) {
+}
+
+TextureCache::~TextureCache() {
+    sprites.clear();        //regions go before the atlas pages they point into
+}
+
+bool TextureCache::buildAtlas(const char* directory) {
+    PROFILE_ZONE("TextureCache::buildAtlas");
+    return atlas.buildFromDirectory(renderer, directory);
+}
+
+std::shared_ptr<Sprite> TextureCache::load(const char* path) {      //decode the image on first request, share it afterwards
+    if (!path)
+        return nullptr;
+
+    auto found = sprites.find(path);
+    if (found != sprites.end())
+        return found->second;
+
+    PROFILE_ZONE("TextureCache::load");     //only misses, a hit is not worth a zone
+    std::shared_ptr<Sprite> sprite;
+    const AtlasRegion* region = atlas.findRegion(path);
+    if (region)
+        sprite = std::make_shared<Sprite>(atlas.getPage(region->page), region->rect);
+    else
+        sprite = std::make_shared<Sprite>(renderer, path);     //failed loads are kept too so a missing file is not retried for every enemy
+    sprites.emplace(path, sprite);
+    return sprite;
+}
+
+std::shared_ptr<Sprite> TextureCache::add(const std::string& key, SDL_Texture* texture) {
+    auto sprite = std::make_shared<Sprite>(texture);
+    sprites[key] = sprite;
+    return sprite;
+}
+
+std::shared_ptr<Sprite> TextureCache::find(const std::string& key) const {
+    auto found = sprites.find(key);
+    if (found == sprites.end())
+        return nullptr;
+    return found->second;
+}
+
+SDL_Renderer* TextureCache::getRenderer() const {
+    return renderer;
+}
+
+const TextureAtlas& TextureCache::getAtlas() const {
+    return atlas;
+}
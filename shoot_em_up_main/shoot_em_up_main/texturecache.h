@@ -0,0 +1,32 @@
+#pragma once
+#include <SDL3/SDL.h>
+#include <memory>
+#include <string>
+#include <unordered_map>
+#include "Sprite.h"
+#include "textureatlas.h"
+
+// Shared sprites keyed by path: every image is decoded and uploaded once per process,
+// then handed out as reference counted handles. Images packed in the atlas become regions of its pages.
+// Must be destroyed after every holder of its sprites (atlas regions do not own their page).
+class TextureCache {
+private:
+    SDL_Renderer* renderer;
+    TextureAtlas atlas;
+    std::unordered_map<std::string, std::shared_ptr<Sprite>> sprites;
+
+public:
+    TextureCache(SDL_Renderer* renderer);
+    ~TextureCache();
+
+    TextureCache(const TextureCache&) = delete;
+    TextureCache& operator=(const TextureCache&) = delete;
+
+    bool buildAtlas(const char* directory);     // call before the first load so the images come from the atlas
+    std::shared_ptr<Sprite> load(const char* path);
+    std::shared_ptr<Sprite> add(const std::string& key, SDL_Texture* texture);     // takes ownership of a generated texture
+    std::shared_ptr<Sprite> find(const std::string& key) const;
+
+    SDL_Renderer* getRenderer() const;
+    const TextureAtlas& getAtlas() const;
+};
@@ -0,0 +1,116 @@
+#include "worldrenderer.h"
+#include "bullet.h"
+#include <cstdio>
+
+WorldRenderer::WorldRenderer(TextureCache& textures) : bulletFill{ 0, 255, 0, 255 }, bulletOutline{ 0, 128, 0, 255 } {     //every sprite is looked up once
+    playerSprite = textures.load("assets/player.png");
+    enemySprites[static_cast<int>(EnemyType::tomato)] = textures.load("assets/tomato.png");
+    enemySprites[static_cast<int>(EnemyType::broccoli)] = textures.load("assets/brocolie.png");
+    enemySprites[static_cast<int>(EnemyType::carrot)] = textures.load("assets/carrot.png");
+
+    enemyBulletSprite = textures.find("generated/enemy_bullet");
+    if (!enemyBulletSprite) {
+        SDL_Texture* texture = createBulletTexture(textures.getRenderer(), static_cast<int>(ENEMY_BULLET_SIZE));
+        if (texture)
+            enemyBulletSprite = textures.add("generated/enemy_bullet", texture);
+    }
+}
+
+SDL_Texture* WorldRenderer::createBulletTexture(SDL_Renderer* renderer, int size) const {       //bakes the neon green round bullet, sized like the bullets
+    SDL_Surface* surface = SDL_CreateSurface(size, size, SDL_PIXELFORMAT_RGBA32);
+    if (!surface) {
+        fprintf(stderr, "Error creating bullet surface\n");
+        return nullptr;
+    }
+
+    const SDL_PixelFormatDetails* format = SDL_GetPixelFormatDetails(surface->format);
+    Uint32 fill = SDL_MapRGBA(format, nullptr, bulletFill.r, bulletFill.g, bulletFill.b, bulletFill.a);
+    Uint32 outline = SDL_MapRGBA(format, nullptr, bulletOutline.r, bulletOutline.g, bulletOutline.b, bulletOutline.a);
+    Uint32 clear = SDL_MapRGBA(format, nullptr, 0, 0, 0, 0);
+
+    //filled inside the radius, one pixel darker ring on the edge
+    float radius = size / 2.0f;
+    for (int y = 0; y < size; y++) {
+        Uint32* row = reinterpret_cast<Uint32*>(static_cast<Uint8*>(surface->pixels) + y * surface->pitch);
+        for (int x = 0; x < size; x++) {
+            float dx = x + 0.5f - radius;
+            float dy = y + 0.5f - radius;
+            float dist_sq = dx * dx + dy * dy;
+            if (dist_sq > radius * radius)
+                row[x] = clear;
+            else if (dist_sq > (radius - 1.0f) * (radius - 1.0f))
+                row[x] = outline;
+            else
+                row[x] = fill;
+        }
+    }
+
+    SDL_Texture* texture = SDL_CreateTextureFromSurface(renderer, surface);
+    SDL_DestroySurface(surface);
+    if (!texture) {
+        fprintf(stderr, "Error creating bullet texture\n");
+        return nullptr;
+    }
+    SDL_SetTextureBlendMode(texture, SDL_BLENDMODE_BLEND);
+    SDL_SetTextureScaleMode(texture, SDL_SCALEMODE_NEAREST);
+    return texture;
+}
+
+void WorldRenderer::drawHealthBar(RenderBatch& batch, const SDL_FRect& rect, int health, int maxHealth, float offset, float height, RenderLayer layer) const {
+    SDL_FRect bg_rect = { rect.x, rect.y - offset, rect.w, height };
+    batch.addFillRect(bg_rect, { 100, 0, 0, 255 }, layer, RectOrder::Background);
+
+    float health_width = maxHealth > 0 ? (rect.w * health) / maxHealth : 0.0f;
+    SDL_FRect health_rect = { rect.x, rect.y - offset, health_width, height };
+    batch.addFillRect(health_rect, { 0, 255, 0, 255 }, layer);
+
+    batch.addOutlineRect(bg_rect, { 255, 255, 255, 255 }, layer);
+}
+
+void WorldRenderer::drawEnemy(RenderBatch& batch, const EnemyView& enemy, float alpha) const {      //sprite of its type with the health bar above
+    SDL_FRect drawRect = interpolateRect(enemy.prev, enemy.rect, alpha);
+    const std::shared_ptr<Sprite>& sprite = enemySprites[static_cast<int>(enemy.type)];
+    if (sprite && sprite->IsValid())
+        sprite->Draw(batch, drawRect, RenderLayer::Enemies);
+
+    drawHealthBar(batch, drawRect, enemy.health, enemy.max_health, 10.0f, 6.0f, RenderLayer::Enemies);
+}
+
+void WorldRenderer::drawPlayer(RenderBatch& batch, const PlayerView& player, float alpha) const {       //draw the player's states
+    SDL_FRect drawRect = interpolateRect(player.prev, player.rect, alpha);
+    bool flashing = player.invulnerable_timer > 0.0f && ((int)(player.invulnerable_timer * 10) % 2 == 0);
+
+    if (playerSprite && playerSprite->IsValid()) {
+        //player flashing when invulnerable, after taking a hit
+        playerSprite->Draw(batch, drawRect, RenderLayer::Player, flashing ? 128.0f / 255.0f : 1.0f);
+    }
+    else {
+        if (flashing) 
+            batch.addFillRect(drawRect, { 255, 255, 255, 255 }, RenderLayer::Player);
+        else 
+            batch.addFillRect(drawRect, { 0, 255, 0, 255 }, RenderLayer::Player);
+    }
+
+    //draw health bar above head
+    drawHealthBar(batch, drawRect, player.health, player.max_health, 20.0f, 8.0f, RenderLayer::Player);
+}
+
+void WorldRenderer::draw(const RenderSnapshot& snapshot, RenderBatch& batch, float alpha) const {
+    for (const auto& enemy : snapshot.enemies)
+        drawEnemy(batch, enemy, alpha);
+
+    drawPlayer(batch, snapshot.player, alpha);
+
+    //yellow bullets with a black outline, the batch groups them by color
+    for (const auto& bullet : snapshot.bullets) {
+        SDL_FRect drawRect = interpolateRect(bullet.prev, bullet.rect, alpha);
+        batch.addFillRect(drawRect, { 255, 255, 0, 255 }, RenderLayer::PlayerBullets);
+        batch.addOutlineRect(drawRect, { 0, 0, 0, 255 }, RenderLayer::PlayerBullets);
+    }
+
+    //every enemy bullet is a quad of the same texture, one geometry call for all of them
+    if (enemyBulletSprite) {
+        for (const auto& bullet : snapshot.enemy_bullets)
+            enemyBulletSprite->Draw(batch, interpolateRect(bullet.prev, bullet.rect, alpha), RenderLayer::EnemyBullets);
+    }
+}
@@ -0,0 +1,28 @@
+#pragma once
+#include <SDL3/SDL.h>
+#include <memory>
+#include "renderbatch.h"
+#include "snapshot.h"
+#include "texturecache.h"
+
+// Turns a simulation snapshot into the frame's draw list, owns every sprite of the game world.
+// Runs on the main thread only.
+class WorldRenderer {
+private:
+    std::shared_ptr<Sprite> playerSprite;
+    std::shared_ptr<Sprite> enemySprites[3];        // indexed by EnemyType
+    std::shared_ptr<Sprite> enemyBulletSprite;      // round bullet baked once per process
+    SDL_Color bulletFill;
+    SDL_Color bulletOutline;
+
+    SDL_Texture* createBulletTexture(SDL_Renderer* renderer, int size) const;
+
+    void drawHealthBar(RenderBatch& batch, const SDL_FRect& rect, int health, int maxHealth, float offset, float height, RenderLayer layer) const;
+    void drawEnemy(RenderBatch& batch, const EnemyView& enemy, float alpha) const;
+    void drawPlayer(RenderBatch& batch, const PlayerView& player, float alpha) const;
+
+public:
+    WorldRenderer(TextureCache& textures);
+
+    void draw(const RenderSnapshot& snapshot, RenderBatch& batch, float alpha) const;
+};
@@ -0,0 +1,142 @@
+#include "aabbkernels.h"
+#include <SDL3/SDL_cpuinfo.h>
+#include <SDL3/SDL_intrin.h>
+#include <cfloat>
+
+static Uint32 testScalar(const SDL_FRect& rect, const float* x, const float* y, const float* w, const float* h, int count) {
+    Uint32 hits = 0;
+    for (int i = 0; i < count; i++) {
+        bool overlap = rect.x < x[i] + w[i] && rect.x + rect.w > x[i] && rect.y < y[i] + h[i] && rect.y + rect.h > y[i];
+        hits |= static_cast<Uint32>(overlap) << i;
+    }
+    return hits;
+}
+
+#ifdef SDL_SSE2_INTRINSICS
+static Uint32 SDL_TARGETING("sse2") testSSE2(const SDL_FRect& rect, const float* x, const float* y, const float* w, const float* h, int count) {
+    const __m128 left = _mm_set1_ps(rect.x);
+    const __m128 top = _mm_set1_ps(rect.y);
+    const __m128 right = _mm_set1_ps(rect.x + rect.w);
+    const __m128 bottom = _mm_set1_ps(rect.y + rect.h);
+    Uint32 hits = 0;
+    int i = 0;
+    for (; i + 4 <= count; i += 4) {
+        __m128 bx = _mm_loadu_ps(x + i);
+        __m128 by = _mm_loadu_ps(y + i);
+        __m128 horizontal = _mm_and_ps(_mm_cmplt_ps(left, _mm_add_ps(bx, _mm_loadu_ps(w + i))), _mm_cmpgt_ps(right, bx));
+        __m128 vertical = _mm_and_ps(_mm_cmplt_ps(top, _mm_add_ps(by, _mm_loadu_ps(h + i))), _mm_cmpgt_ps(bottom, by));
+        hits |= static_cast<Uint32>(_mm_movemask_ps(_mm_and_ps(horizontal, vertical))) << i;
+    }
+    if (i < count)
+        hits |= testScalar(rect, x + i, y + i, w + i, h + i, count - i) << i;
+    return hits;
+}
+#endif
+
+#ifdef SDL_AVX2_INTRINSICS
+static Uint32 SDL_TARGETING("avx2") testAVX2(const SDL_FRect& rect, const float* x, const float* y, const float* w, const float* h, int count) {
+    const __m256 left = _mm256_set1_ps(rect.x);
+    const __m256 top = _mm256_set1_ps(rect.y);
+    const __m256 right = _mm256_set1_ps(rect.x + rect.w);
+    const __m256 bottom = _mm256_set1_ps(rect.y + rect.h);
+    Uint32 hits = 0;
+    int i = 0;
+    for (; i + 8 <= count; i += 8) {
+        __m256 bx = _mm256_loadu_ps(x + i);
+        __m256 by = _mm256_loadu_ps(y + i);
+        __m256 horizontal = _mm256_and_ps(_mm256_cmp_ps(left, _mm256_add_ps(bx, _mm256_loadu_ps(w + i)), _CMP_LT_OQ), _mm256_cmp_ps(right, bx, _CMP_GT_OQ));
+        __m256 vertical = _mm256_and_ps(_mm256_cmp_ps(top, _mm256_add_ps(by, _mm256_loadu_ps(h + i)), _CMP_LT_OQ), _mm256_cmp_ps(bottom, by, _CMP_GT_OQ));
+        hits |= static_cast<Uint32>(_mm256_movemask_ps(_mm256_and_ps(horizontal, vertical))) << i;
+    }
+    if (i < count)
+        hits |= testScalar(rect, x + i, y + i, w + i, h + i, count - i) << i;
+    return hits;
+}
+#endif
+
+typedef Uint32 (*AABBKernel)(const SDL_FRect&, const float*, const float*, const float*, const float*, int);
+
+static AABBKernel selectKernel() {      //asked once, the cpu does not change while running
+#ifdef SDL_AVX2_INTRINSICS
+    if (SDL_HasAVX2())
+        return testAVX2;
+#endif
+#ifdef SDL_SSE2_INTRINSICS
+    if (SDL_HasSSE2())
+        return testSSE2;
+#endif
+    return testScalar;
+}
+
+Uint32 testAABBs(const SDL_FRect& rect, const float* x, const float* y, const float* w, const float* h, int count) {
+    static const AABBKernel kernel = selectKernel();
+    if (count > AABB_BATCH_MAX)
+        count = AABB_BATCH_MAX;
+    return kernel(rect, x, y, w, h, count);
+}
+
+
+void AABBBatch::clear() {
+    x.clear();
+    y.clear();
+    w.clear();
+    h.clear();
+    group.clear();
+    index.clear();
+}
+
+void AABBBatch::push(const SDL_FRect& rect, int candidateGroup, int candidateIndex) {
+    x.push_back(rect.x);
+    y.push_back(rect.y);
+    w.push_back(rect.w);
+    h.push_back(rect.h);
+    group.push_back(candidateGroup);
+    index.push_back(candidateIndex);
+}
+
+int AABBBatch::size() const {
+    return static_cast<int>(x.size());
+}
+
+bool sweepAABB(const SDL_FRect& moving, float dx, float dy, const SDL_FRect& target, float& toi) {       //slab test, the box overlaps on both axes between entry and exit
+    float entry = -FLT_MAX;
+    float exit = FLT_MAX;
+
+    const float movingPos[2] = { moving.x, moving.y };
+    const float movingSize[2] = { moving.w, moving.h };
+    const float targetPos[2] = { target.x, target.y };
+    const float targetSize[2] = { target.w, target.h };
+    const float delta[2] = { dx, dy };
+
+    for (int axis = 0; axis < 2; axis++) {
+        float near = targetPos[axis] - (movingPos[axis] + movingSize[axis]);       //gap to close before touching
+        float far = targetPos[axis] + targetSize[axis] - movingPos[axis];           //gap to close before leaving
+        if (delta[axis] == 0.0f) {
+            if (near >= 0.0f || far <= 0.0f)      //never overlaps on this axis
+                return false;
+            continue;
+        }
+        float t0 = near / delta[axis];
+        float t1 = far / delta[axis];
+        if (t0 > t1) {
+            float swap = t0;
+            t0 = t1;
+            t1 = swap;
+        }
+        entry = SDL_max(entry, t0);
+        exit = SDL_min(exit, t1);
+    }
+
+    if (entry >= exit || entry >= 1.0f || exit <= 0.0f)
+        return false;
+    toi = SDL_max(entry, 0.0f);
+    return true;
+}
+
+SDL_FRect sweptBounds(const SDL_FRect& from, const SDL_FRect& to) {
+    float left = SDL_min(from.x, to.x);
+    float top = SDL_min(from.y, to.y);
+    float right = SDL_max(from.x + from.w, to.x + to.w);
+    float bottom = SDL_max(from.y + from.h, to.y + to.h);
+    return { left, top, right - left, bottom - top };
+}
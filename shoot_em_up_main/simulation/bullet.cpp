@@ -0,0 +1,145 @@
+#include "bullet.h"
+#include "bulletkernels.h"
+
+//bullet columns
+void BulletColumns::resize(int capacity) {       //keeps the bullets already there, the new slots are inactive
+    int padded = (capacity + BULLET_MASK_BITS - 1) / BULLET_MASK_BITS * BULLET_MASK_BITS;
+    for (std::vector<float>* column : { &x, &y, &w, &h, &vx, &vy, &prev_x, &prev_y })
+        column->resize(padded, 0.0f);
+    active.resize(padded / BULLET_MASK_BITS, 0);
+}
+
+void BulletColumns::move(int dst, int src) {
+    x[dst] = x[src];
+    y[dst] = y[src];
+    w[dst] = w[src];
+    h[dst] = h[src];
+    vx[dst] = vx[src];
+    vy[dst] = vy[src];
+    prev_x[dst] = prev_x[src];
+    prev_y[dst] = prev_y[src];
+    if (isActive(src))
+        active[dst / BULLET_MASK_BITS] |= 1u << (dst % BULLET_MASK_BITS);
+    else
+        deactivate(dst);
+}
+
+void BulletColumns::reset(int i) {      //a free slot still goes through the kernels, it just never counts
+    vx[i] = 0.0f;
+    vy[i] = 0.0f;
+    deactivate(i);
+}
+
+bool BulletColumns::isActive(int i) const {
+    return (active[i / BULLET_MASK_BITS] >> (i % BULLET_MASK_BITS)) & 1u;
+}
+
+void BulletColumns::deactivate(int i) {
+    active[i / BULLET_MASK_BITS] &= ~(1u << (i % BULLET_MASK_BITS));
+}
+
+void BulletColumns::spawn(int i, float px, float py, float pw, float ph, float pvx, float pvy) {
+    x[i] = px;
+    y[i] = py;
+    w[i] = pw;
+    h[i] = ph;
+    vx[i] = pvx;
+    vy[i] = pvy;
+    prev_x[i] = px;         //no motion to interpolate on the spawn tick
+    prev_y[i] = py;
+    active[i / BULLET_MASK_BITS] |= 1u << (i % BULLET_MASK_BITS);
+}
+
+void BulletColumns::update(float dt, const SDL_FRect& area, int count) {       //the live bullets move, then the ones out of the area are dropped from the mask
+    int padded = (count + BULLET_MASK_BITS - 1) / BULLET_MASK_BITS * BULLET_MASK_BITS;
+    if (padded == 0)
+        return;
+    integrateBullets(x.data(), y.data(), prev_x.data(), prev_y.data(), vx.data(), vy.data(), padded, dt);
+    cullBullets(x.data(), y.data(), w.data(), h.data(), active.data(), padded, area);
+}
+
+SDL_FRect BulletColumns::getRect(int i) const {
+    return { x[i], y[i], w[i], h[i] };
+}
+
+SDL_FRect BulletColumns::getPrevRect(int i) const {
+    return { prev_x[i], prev_y[i], w[i], h[i] };
+}
+
+
+//pooled bullets with a cooldown
+BulletManager::BulletManager(int capacity, float cooldown, int maxCapacity) : bullets(capacity, maxCapacity), shoot_cooldown(cooldown), cooldown_timer(0.0f) {
+}
+
+void BulletManager::update(float dt) {
+    if (cooldown_timer > 0.0f) {
+        cooldown_timer -= dt;
+        if (cooldown_timer < 0.0f) 
+            cooldown_timer = 0.0f;
+    }
+}
+
+bool BulletManager::canShoot() const {     //verify if shoot is available
+    return cooldown_timer <= 0.0f;
+}
+
+bool BulletManager::spawn(float x, float y, float w, float h, float vx, float vy) {        //false only when the pool is full and cannot grow
+    if (cooldown_timer > 0.0f)
+        return false;
+
+    int slot = bullets.acquire();
+    if (slot < 0)
+        return false;
+    bullets.get().spawn(slot, x, y, w, h, vx, vy);
+    cooldown_timer = shoot_cooldown;
+    return true;
+}
+
+void BulletManager::updateBullets(float dt, const SDL_FRect& area) {       //update the bullets, the ones leaving the area are freed
+    releaseInactive();      //hit during the last collision pass
+    bullets.get().update(dt, area, bullets.size());
+    releaseInactive();
+}
+
+void BulletManager::releaseInactive() {     //from the back, so the bullet moved into a freed slot was already checked
+    const BulletColumns& columns = bullets.get();
+    for (int i = bullets.size() - 1; i >= 0; i--) {
+        if (!columns.isActive(i))
+            bullets.release(i);
+    }
+}
+
+void BulletManager::reset() {       //when reseted, delete bullet
+    cooldown_timer = 0.0f;
+    bullets.clear();
+}
+
+int BulletManager::getCount() const {
+    return bullets.size();
+}
+
+BulletColumns& BulletManager::getBullets() {
+    return bullets.get();
+}
+
+const BulletColumns& BulletManager::getBullets() const {
+    return bullets.get();
+}
+
+
+//player's bullets
+PlayerBulletManager::PlayerBulletManager(int capacity, float cooldown) : BulletManager(capacity, cooldown) {
+}
+
+void PlayerBulletManager::shoot(float x, float y) {       //attack of the player when shooting a bullet
+    spawn(x, y, PLAYER_BULLET_W, PLAYER_BULLET_H, 0.0f, -PLAYER_BULLET_SPEED);
+}
+
+
+//enemy's bullets
+EnemyBulletManager::EnemyBulletManager(int capacity, float cooldown) : BulletManager(capacity, cooldown) {     //manages the cooldown and shooting system
+}
+
+void EnemyBulletManager::shoot(float x, float y) {      //enemy's attack, centered on x
+    spawn(x - ENEMY_BULLET_SIZE / 2.0f, y, ENEMY_BULLET_SIZE, ENEMY_BULLET_SIZE, 0.0f, ENEMY_BULLET_SPEED);
+}
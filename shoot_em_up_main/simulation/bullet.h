@@ -0,0 +1,78 @@
+#pragma once
+
+#include <SDL3/SDL_stdinc.h>
+#include <SDL3/SDL_rect.h>
+#include <vector>
+#include "pool.h"
+
+static const float PLAYER_BULLET_W = 5.0f;
+static const float PLAYER_BULLET_H = 15.0f;
+static const float PLAYER_BULLET_SPEED = 1000.0f;      // upward
+static const float ENEMY_BULLET_SIZE = 15.0f;
+static const float ENEMY_BULLET_SPEED = 500.0f;        // downward
+
+// Bullets stored one column per field so the update kernels can run over all of them at once
+// (see bulletkernels.h). Used as the storage of a Pool, which keeps the live bullets packed at the front.
+// The columns are padded to whole mask words, slots past the pool size are never active.
+class BulletColumns {
+public:
+    std::vector<float> x;
+    std::vector<float> y;
+    std::vector<float> w;
+    std::vector<float> h;
+    std::vector<float> vx;
+    std::vector<float> vy;
+    std::vector<float> prev_x;      // position at the previous tick, for interpolated drawing
+    std::vector<float> prev_y;
+    std::vector<Uint32> active;     // one bit per slot, cleared when a bullet is hit or leaves the area
+
+    void resize(int capacity);
+    void move(int dst, int src);
+    void reset(int i);
+
+    bool isActive(int i) const;
+    void deactivate(int i);
+
+    void spawn(int i, float x, float y, float w, float h, float vx, float vy);
+    void update(float dt, const SDL_FRect& area, int count);
+
+    SDL_FRect getRect(int i) const;
+    SDL_FRect getPrevRect(int i) const;
+};
+
+// Pooled bullets with a shooting cooldown, the player and the enemies each have one
+class BulletManager {
+private:
+    Pool<BulletColumns> bullets;
+    float shoot_cooldown;
+    float cooldown_timer;
+
+    void releaseInactive();
+
+public:
+    BulletManager(int capacity = 100, float cooldown = 0.1f, int maxCapacity = 0);
+
+    void update(float dt);
+    bool canShoot() const;
+    bool spawn(float x, float y, float w, float h, float vx, float vy);
+    void updateBullets(float dt, const SDL_FRect& area);
+    void reset();
+
+    int getCount() const;
+    BulletColumns& getBullets();
+    const BulletColumns& getBullets() const;
+};
+
+class PlayerBulletManager : public BulletManager {
+public:
+    PlayerBulletManager(int capacity = 100, float cooldown = 0.1f);
+
+    void shoot(float x, float y);
+};
+
+class EnemyBulletManager : public BulletManager {
+public:
+    EnemyBulletManager(int capacity, float cooldown = 0.5f);
+
+    void shoot(float x, float y);
+};
@@ -0,0 +1,159 @@
+#include "bulletkernels.h"
+#include <SDL3/SDL_cpuinfo.h>
+#include <SDL3/SDL_intrin.h>
+
+//plain versions, also the reference the others must match
+static void integrateScalar(float* x, float* y, float* prev_x, float* prev_y, const float* vx, const float* vy, int count, float dt) {
+    for (int i = 0; i < count; i++) {
+        prev_x[i] = x[i];
+        prev_y[i] = y[i];
+        x[i] += vx[i] * dt;
+        y[i] += vy[i] * dt;
+    }
+}
+
+static void cullScalar(const float* x, const float* y, const float* w, const float* h, Uint32* active, int count, const SDL_FRect& area) {       //a bullet stays while it touches the area
+    const float right = area.x + area.w;
+    const float bottom = area.y + area.h;
+    for (int word = 0; word < count / BULLET_MASK_BITS; word++) {
+        Uint32 keep = 0;
+        for (int bit = 0; bit < BULLET_MASK_BITS; bit++) {
+            int i = word * BULLET_MASK_BITS + bit;
+            bool inside = x[i] + w[i] >= area.x && x[i] <= right && y[i] + h[i] >= area.y && y[i] <= bottom;
+            keep |= static_cast<Uint32>(inside) << bit;
+        }
+        active[word] &= keep;
+    }
+}
+
+#ifdef SDL_SSE2_INTRINSICS
+static void SDL_TARGETING("sse2") integrateSSE2(float* x, float* y, float* prev_x, float* prev_y, const float* vx, const float* vy, int count, float dt) {
+    const __m128 step = _mm_set1_ps(dt);
+    for (int i = 0; i < count; i += 4) {
+        __m128 px = _mm_loadu_ps(x + i);
+        __m128 py = _mm_loadu_ps(y + i);
+        _mm_storeu_ps(prev_x + i, px);
+        _mm_storeu_ps(prev_y + i, py);
+        _mm_storeu_ps(x + i, _mm_add_ps(px, _mm_mul_ps(_mm_loadu_ps(vx + i), step)));
+        _mm_storeu_ps(y + i, _mm_add_ps(py, _mm_mul_ps(_mm_loadu_ps(vy + i), step)));
+    }
+}
+
+static void SDL_TARGETING("sse2") cullSSE2(const float* x, const float* y, const float* w, const float* h, Uint32* active, int count, const SDL_FRect& area) {
+    const __m128 left = _mm_set1_ps(area.x);
+    const __m128 top = _mm_set1_ps(area.y);
+    const __m128 right = _mm_set1_ps(area.x + area.w);
+    const __m128 bottom = _mm_set1_ps(area.y + area.h);
+    for (int word = 0; word < count / BULLET_MASK_BITS; word++) {
+        Uint32 keep = 0;
+        for (int lane = 0; lane < BULLET_MASK_BITS; lane += 4) {
+            int i = word * BULLET_MASK_BITS + lane;
+            __m128 px = _mm_loadu_ps(x + i);
+            __m128 py = _mm_loadu_ps(y + i);
+            __m128 horizontal = _mm_and_ps(_mm_cmpge_ps(_mm_add_ps(px, _mm_loadu_ps(w + i)), left), _mm_cmple_ps(px, right));
+            __m128 vertical = _mm_and_ps(_mm_cmpge_ps(_mm_add_ps(py, _mm_loadu_ps(h + i)), top), _mm_cmple_ps(py, bottom));
+            keep |= static_cast<Uint32>(_mm_movemask_ps(_mm_and_ps(horizontal, vertical))) << lane;
+        }
+        active[word] &= keep;
+    }
+}
+#endif
+
+#ifdef SDL_AVX2_INTRINSICS
+static void SDL_TARGETING("avx2") integrateAVX2(float* x, float* y, float* prev_x, float* prev_y, const float* vx, const float* vy, int count, float dt) {
+    const __m256 step = _mm256_set1_ps(dt);
+    for (int i = 0; i < count; i += 8) {
+        __m256 px = _mm256_loadu_ps(x + i);
+        __m256 py = _mm256_loadu_ps(y + i);
+        _mm256_storeu_ps(prev_x + i, px);
+        _mm256_storeu_ps(prev_y + i, py);
+        _mm256_storeu_ps(x + i, _mm256_add_ps(px, _mm256_mul_ps(_mm256_loadu_ps(vx + i), step)));
+        _mm256_storeu_ps(y + i, _mm256_add_ps(py, _mm256_mul_ps(_mm256_loadu_ps(vy + i), step)));
+    }
+}
+
+static void SDL_TARGETING("avx2") cullAVX2(const float* x, const float* y, const float* w, const float* h, Uint32* active, int count, const SDL_FRect& area) {
+    const __m256 left = _mm256_set1_ps(area.x);
+    const __m256 top = _mm256_set1_ps(area.y);
+    const __m256 right = _mm256_set1_ps(area.x + area.w);
+    const __m256 bottom = _mm256_set1_ps(area.y + area.h);
+    for (int word = 0; word < count / BULLET_MASK_BITS; word++) {
+        Uint32 keep = 0;
+        for (int lane = 0; lane < BULLET_MASK_BITS; lane += 8) {
+            int i = word * BULLET_MASK_BITS + lane;
+            __m256 px = _mm256_loadu_ps(x + i);
+            __m256 py = _mm256_loadu_ps(y + i);
+            __m256 horizontal = _mm256_and_ps(_mm256_cmp_ps(_mm256_add_ps(px, _mm256_loadu_ps(w + i)), left, _CMP_GE_OQ), _mm256_cmp_ps(px, right, _CMP_LE_OQ));
+            __m256 vertical = _mm256_and_ps(_mm256_cmp_ps(_mm256_add_ps(py, _mm256_loadu_ps(h + i)), top, _CMP_GE_OQ), _mm256_cmp_ps(py, bottom, _CMP_LE_OQ));
+            keep |= static_cast<Uint32>(_mm256_movemask_ps(_mm256_and_ps(horizontal, vertical))) << lane;
+        }
+        active[word] &= keep;
+    }
+}
+#endif
+
+enum class BulletKernel { Scalar, SSE2, AVX2 };
+
+static BulletKernel selectKernel() {        //asked once, the cpu does not change while running
+#ifdef SDL_AVX2_INTRINSICS
+    if (SDL_HasAVX2())
+        return BulletKernel::AVX2;
+#endif
+#ifdef SDL_SSE2_INTRINSICS
+    if (SDL_HasSSE2())
+        return BulletKernel::SSE2;
+#endif
+    return BulletKernel::Scalar;
+}
+
+static BulletKernel getKernel() {
+    static const BulletKernel kernel = selectKernel();
+    return kernel;
+}
+
+void integrateBullets(float* x, float* y, float* prev_x, float* prev_y, const float* vx, const float* vy, int count, float dt) {
+    switch (getKernel()) {
+#ifdef SDL_AVX2_INTRINSICS
+    case BulletKernel::AVX2:
+        integrateAVX2(x, y, prev_x, prev_y, vx, vy, count, dt);
+        return;
+#endif
+#ifdef SDL_SSE2_INTRINSICS
+    case BulletKernel::SSE2:
+        integrateSSE2(x, y, prev_x, prev_y, vx, vy, count, dt);
+        return;
+#endif
+    default:
+        integrateScalar(x, y, prev_x, prev_y, vx, vy, count, dt);
+        return;
+    }
+}
+
+void cullBullets(const float* x, const float* y, const float* w, const float* h, Uint32* active, int count, const SDL_FRect& area) {
+    switch (getKernel()) {
+#ifdef SDL_AVX2_INTRINSICS
+    case BulletKernel::AVX2:
+        cullAVX2(x, y, w, h, active, count, area);
+        return;
+#endif
+#ifdef SDL_SSE2_INTRINSICS
+    case BulletKernel::SSE2:
+        cullSSE2(x, y, w, h, active, count, area);
+        return;
+#endif
+    default:
+        cullScalar(x, y, w, h, active, count, area);
+        return;
+    }
+}
+
+const char* getBulletKernelName() {
+    switch (getKernel()) {
+    case BulletKernel::AVX2:
+        return "avx2";
+    case BulletKernel::SSE2:
+        return "sse2";
+    default:
+        return "scalar";
+    }
+}
@@ -0,0 +1,11 @@
+#pragma once
+#include <SDL3/SDL_stdinc.h>
+#include <SDL3/SDL_rect.h>
+
+// Update kernels over the bullet columns. count has to be a multiple of BULLET_MASK_BITS,
+// the widest version the CPU supports (AVX2, SSE2 or plain C++) is picked on the first call.
+static const int BULLET_MASK_BITS = 32;     // slots per word of the active mask
+
+void integrateBullets(float* x, float* y, float* prev_x, float* prev_y, const float* vx, const float* vy, int count, float dt);
+void cullBullets(const float* x, const float* y, const float* w, const float* h, Uint32* active, int count, const SDL_FRect& area);
+const char* getBulletKernelName();
@@ -0,0 +1,58 @@
+#include "collisiongrid.h"
+
+CollisionGrid::CollisionGrid() : area{ 0.0f, 0.0f, 0.0f, 0.0f }, cell_size(64.0f), columns(1), rows(1), query_id(0) {
+    cell_start.assign(2, 0);
+}
+
+void CollisionGrid::setArea(const SDL_FRect& newArea, float cellSize) {      //cheap when nothing changed, called every tick
+    if (newArea.x == area.x && newArea.y == area.y && newArea.w == area.w && newArea.h == area.h && cellSize == cell_size)
+        return;
+    area = newArea;
+    cell_size = cellSize > 0.0f ? cellSize : 64.0f;
+    columns = SDL_max(1, static_cast<int>(SDL_ceilf(area.w / cell_size)));
+    rows = SDL_max(1, static_cast<int>(SDL_ceilf(area.h / cell_size)));
+}
+
+void CollisionGrid::clear() {
+    items.clear();
+}
+
+void CollisionGrid::insert(const SDL_FRect& rect, Uint32 layer, int group, int index) {
+    items.push_back({ rect, layer, group, index });
+}
+
+void CollisionGrid::cellRange(const SDL_FRect& rect, int& x0, int& y0, int& x1, int& y1) const {      //cells covered by rect, clamped to the grid
+    x0 = SDL_clamp(static_cast<int>(SDL_floorf((rect.x - area.x) / cell_size)), 0, columns - 1);
+    y0 = SDL_clamp(static_cast<int>(SDL_floorf((rect.y - area.y) / cell_size)), 0, rows - 1);
+    x1 = SDL_clamp(static_cast<int>(SDL_floorf((rect.x + rect.w - area.x) / cell_size)), 0, columns - 1);
+    y1 = SDL_clamp(static_cast<int>(SDL_floorf((rect.y + rect.h - area.y) / cell_size)), 0, rows - 1);
+}
+
+void CollisionGrid::build() {       //counting sort of the items into their cells, two passes over the items
+    const int cells = columns * rows;
+    cell_start.assign(cells + 1, 0);
+
+    int x0, y0, x1, y1;
+    for (const GridItem& item : items) {
+        cellRange(item.rect, x0, y0, x1, y1);
+        for (int cy = y0; cy <= y1; cy++) {
+            for (int cx = x0; cx <= x1; cx++)
+                cell_start[cy * columns + cx + 1]++;
+        }
+    }
+    for (int c = 0; c < cells; c++)
+        cell_start[c + 1] += cell_start[c];
+
+    cell_items.resize(cell_start[cells]);
+    cell_fill.assign(cell_start.begin(), cell_start.end() - 1);
+    for (int i = 0; i < static_cast<int>(items.size()); i++) {
+        cellRange(items[i].rect, x0, y0, x1, y1);
+        for (int cy = y0; cy <= y1; cy++) {
+            for (int cx = x0; cx <= x1; cx++)
+                cell_items[cell_fill[cy * columns + cx]++] = i;
+        }
+    }
+
+    visited.assign(items.size(), 0);
+    query_id = 0;
+}
@@ -0,0 +1,74 @@
+#pragma once
+#include <SDL3/SDL_stdinc.h>
+#include <SDL3/SDL_rect.h>
+#include <vector>
+
+// What a rect in the grid is, queries only see the layers they ask for
+enum CollisionLayer : Uint32 {
+    LAYER_PLAYER = 1 << 0,
+    LAYER_ENEMY = 1 << 1,
+    LAYER_PLAYER_BULLET = 1 << 2,
+    LAYER_ENEMY_BULLET = 1 << 3
+};
+
+struct GridItem {
+    SDL_FRect rect;
+    Uint32 layer;
+    int group;      // which array index refers to, an archetype for enemies
+    int index;
+};
+
+// Uniform grid broad phase over the play area, rebuilt every tick: insert everything, build, then query.
+// Rects outside the area are kept in the border cells, so they are never missed.
+class CollisionGrid {
+private:
+    SDL_FRect area;
+    float cell_size;
+    int columns;
+    int rows;
+
+    std::vector<GridItem> items;
+    std::vector<int> cell_start;        // items of cell c are cell_items[cell_start[c] .. cell_start[c + 1])
+    std::vector<int> cell_items;
+    std::vector<int> cell_fill;         // write position per cell while building
+    std::vector<Uint32> visited;        // per item, last query that reported it
+    Uint32 query_id;
+
+    void cellRange(const SDL_FRect& rect, int& x0, int& y0, int& x1, int& y1) const;
+
+public:
+    CollisionGrid();
+
+    void setArea(const SDL_FRect& area, float cellSize);
+    void clear();
+    void insert(const SDL_FRect& rect, Uint32 layer, int group, int index);
+    void build();
+
+    // calls f(const GridItem&) once for every item of the layers in mask sharing a cell with rect,
+    // f returns true to stop the query
+    template <typename F>
+    void query(const SDL_FRect& rect, Uint32 mask, F f) {
+        if (items.empty())
+            return;
+        if (++query_id == 0) {      //wrapped, forget every old mark
+            visited.assign(visited.size(), 0);
+            query_id = 1;
+        }
+
+        int x0, y0, x1, y1;
+        cellRange(rect, x0, y0, x1, y1);
+        for (int cy = y0; cy <= y1; cy++) {
+            for (int cx = x0; cx <= x1; cx++) {
+                int cell = cy * columns + cx;
+                for (int k = cell_start[cell]; k < cell_start[cell + 1]; k++) {
+                    int item = cell_items[k];
+                    if (visited[item] == query_id || !(items[item].layer & mask))
+                        continue;
+                    visited[item] = query_id;
+                    if (f(items[item]))
+                        return;
+                }
+            }
+        }
+    }
+};
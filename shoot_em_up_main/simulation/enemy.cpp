@@ -0,0 +1,272 @@
+#include "enemy.h"
+#include <iostream>
+#include <fstream>
+#include <string>
+
+static const float SPAWN_MARGIN = 64.0f;       //enemies are created this far above the screen, so they slide in
+static const float PATROL_SPEED = 120.0f;
+
+EnemyType parseEnemyType(const std::string& typeStr) {       //converts a string into an enemy type
+    if (typeStr == "tomato")
+        return EnemyType::tomato;
+    if (typeStr == "broccoli")
+        return EnemyType::broccoli;
+    if (typeStr == "carrot")
+        return EnemyType::carrot;
+    return EnemyType();
+}
+
+
+
+EnemyManager::EnemyManager(EntityStore* entities) : entities(entities), level_time(0.0f), play_area_x(0), play_area_width(0), screen_height(0), bullet_manager(nullptr), enemy_file("setUpEnemy.txt"),
+alive_count(0), killed_count(0), escaped_count(0) {
+}
+
+void EnemyManager::setupEnemies(int play_x, int play_width, int screen_h, const char* filename) {     //set up enemies from text file
+    if (play_width <= 0)
+        return;
+
+    this->play_area_x = play_x;
+    this->play_area_width = play_width;
+    this->screen_height = screen_h;
+    entities->clearEnemies();
+    spawn_queue = {};
+    level_time = 0.0f;
+    resetCounters();
+
+    // store filename for future reset calls
+    if (filename)
+        this->enemy_file = filename;
+
+    std::ifstream myfile(this->enemy_file);
+    std::string currentLine;
+    if (myfile.is_open()) {
+        while (myfile.good()) {     //gets each line to take the parameters
+            // read 6 lines per enemy; skip empty lines
+            std::getline(myfile, currentLine);
+            if (currentLine.empty())
+                continue;
+
+            float relX = std::stof(currentLine);
+
+            std::getline(myfile, currentLine);
+            float start_y = std::stof(currentLine);
+
+            std::getline(myfile, currentLine);
+            float w = std::stof(currentLine);
+
+            std::getline(myfile, currentLine);
+            float h = std::stof(currentLine);
+
+            std::getline(myfile, currentLine);
+            float speed = std::stof(currentLine);
+
+            std::getline(myfile, currentLine);
+            EnemyType enemy = parseEnemyType(currentLine);
+
+            scheduleEnemy(play_x + relX, start_y, w, h, speed, enemy);
+                
+            
+        }
+    }
+
+    spawnDue();         //the ones already on screen at the start
+}
+
+void EnemyManager::scheduleEnemy(float x, float y, float w, float h, float speed, EnemyType type) {     //queued by the time it comes into view
+    float enter_time = 0.0f;
+    float distance = -SPAWN_MARGIN - (y + h);
+    if (distance > 0.0f && speed > 0.0f)
+        enter_time = distance / speed;
+    spawn_queue.push({ enter_time, x, y, w, h, speed, type });
+}
+
+void EnemyManager::spawnDue() {
+    while (!spawn_queue.empty() && spawn_queue.top().enter_time <= level_time) {
+        addEnemy(spawn_queue.top());
+        spawn_queue.pop();
+    }
+}
+
+void EnemyManager::addEnemy(const SpawnRecord& record) {      //placed where it would be if it had existed since the level started
+    int row;
+    ArchetypeId id = record.type == EnemyType::tomato ? ArchetypeId::Patroller : ArchetypeId::Walker;
+    EntityHandle handle = entities->create(id, row);
+    Archetype& enemies = entities->get(id);
+    float x = record.x;
+    float y = record.y + record.speed * level_time;
+    enemies.w[row] = record.w;
+    enemies.h[row] = record.h;
+    enemies.vy[row] = record.speed;
+    enemies.health[row] = 10;
+    enemies.max_health[row] = 10;
+    enemies.type[row] = record.type;
+
+    if (enemies.has(COMPONENT_PATROL)) {        //tomatoes also go side to side inside the play area
+        float min_x = static_cast<float>(play_area_x);
+        float max_x = static_cast<float>(play_area_x + play_area_width);
+        float vx = PATROL_SPEED;
+        float span = max_x - record.w - min_x;
+        if (span > 0.0f) {      //bouncing is a triangle wave over the span
+            float phase = SDL_fmodf(SDL_clamp(x, min_x, min_x + span) - min_x + PATROL_SPEED * level_time, 2.0f * span);
+            if (phase <= span)
+                x = min_x + phase;
+            else {
+                x = min_x + 2.0f * span - phase;
+                vx = -PATROL_SPEED;
+            }
+        }
+        enemies.vx[row] = vx;
+        enemies.min_x[row] = min_x;
+        enemies.max_x[row] = max_x;
+    }
+
+    enemies.x[row] = x;
+    enemies.y[row] = y;
+    enemies.prev_x[row] = x;
+    enemies.prev_y[row] = y;
+
+    alive_count++;
+    if (y >= 0.0f)
+        addShooter(handle);
+}
+
+void EnemyManager::addShooter(EntityHandle handle) {
+    if (handle.index >= shooter_slot.size())
+        shooter_slot.resize(handle.index + 1, -1);
+    shooter_slot[handle.index] = static_cast<int>(shooters.size());
+    shooters.push_back(handle);
+}
+
+void EnemyManager::removeShooter(Uint32 handleIndex) {      //swap with the last one, no-op when it was not on screen yet
+    if (handleIndex >= shooter_slot.size() || shooter_slot[handleIndex] < 0)
+        return;
+    int slot = shooter_slot[handleIndex];
+    shooters[slot] = shooters.back();
+    shooter_slot[shooters[slot].index] = slot;
+    shooters.pop_back();
+    shooter_slot[handleIndex] = -1;
+}
+
+void EnemyManager::resetCounters() {
+    alive_count = 0;
+    killed_count = 0;
+    escaped_count = 0;
+    shooters.clear();
+    shooter_slot.assign(shooter_slot.size(), -1);
+}
+
+void EnemyManager::update(float dt) {       //movement systems, each one only reads the columns it needs
+    spawnDue();
+    entities->forEach(COMPONENT_TRANSFORM | COMPONENT_VELOCITY, [dt](Archetype& moving) {
+        for (int i = 0; i < moving.count; i++) {
+            moving.prev_x[i] = moving.x[i];
+            moving.prev_y[i] = moving.y[i];
+            moving.x[i] += moving.vx[i] * dt;
+            moving.y[i] += moving.vy[i] * dt;
+        }
+    });
+
+    //enemies crossing the top edge this tick can start shooting
+    entities->forEach(COMPONENT_TRANSFORM | COMPONENT_HEALTH | COMPONENT_KIND, [&](Archetype& enemies) {
+        for (int i = 0; i < enemies.count; i++) {
+            if (enemies.prev_y[i] < 0.0f && enemies.y[i] >= 0.0f && enemies.health[i] > 0)
+                addShooter(entities->getHandle(enemies.id, i));
+        }
+    });
+
+    entities->forEach(COMPONENT_TRANSFORM | COMPONENT_VELOCITY | COMPONENT_PATROL, [](Archetype& patrolling) {
+        for (int i = 0; i < patrolling.count; i++) {
+            if (patrolling.x[i] <= patrolling.min_x[i]) {
+                patrolling.x[i] = patrolling.min_x[i];
+                patrolling.vx[i] = SDL_fabsf(patrolling.vx[i]);
+            }
+            else if (patrolling.x[i] + patrolling.w[i] >= patrolling.max_x[i]) {
+                patrolling.x[i] = patrolling.max_x[i] - patrolling.w[i];
+                patrolling.vx[i] = -SDL_fabsf(patrolling.vx[i]);
+            }
+        }
+    });
+    level_time += dt;
+}
+
+bool EnemyManager::damage(ArchetypeId id, int row, int amount) {       //true when this hit killed it
+    Archetype& enemies = entities->get(id);
+    if (enemies.health[row] <= 0)
+        return false;
+    enemies.health[row] -= amount;
+    if (enemies.health[row] > 0)
+        return false;
+
+    enemies.health[row] = 0;
+    removeShooter(enemies.handle[row]);
+    alive_count--;
+    killed_count++;
+    return true;
+}
+
+void EnemyManager::removeDestroyed() {      //dead and escaped enemies leave the store, the loops only see the ones still in play
+    const float bottom = static_cast<float>(screen_height);
+    entities->forEach(COMPONENT_TRANSFORM | COMPONENT_HEALTH | COMPONENT_KIND, [&](Archetype& enemies) {
+        for (int i = enemies.count - 1; i >= 0; i--) {      //from the back, the row moved into a hole was already checked
+            if (enemies.health[i] > 0 && enemies.y[i] > bottom) {
+                removeShooter(enemies.handle[i]);
+                alive_count--;
+                escaped_count++;
+            }
+            else if (enemies.health[i] > 0)
+                continue;
+            entities->destroy(enemies.id, i);
+        }
+    });
+}
+
+void EnemyManager::reset() {        //reset positions
+    if (play_area_width > 0)
+        setupEnemies(play_area_x, play_area_width, screen_height, enemy_file.c_str());
+}
+
+
+bool EnemyManager::allDestroyed() const {       //every enemy of the level has spawned and none is left in play
+    return spawn_queue.empty() && alive_count == 0;
+}
+
+int EnemyManager::countAlive() const {
+    return alive_count;
+}
+
+int EnemyManager::countPending() const {
+    return static_cast<int>(spawn_queue.size());
+}
+
+int EnemyManager::countKilled() const {
+    return killed_count;
+}
+
+int EnemyManager::countEscaped() const {
+    return escaped_count;
+}
+
+void EnemyManager::setBulletManager(EnemyBulletManager* manager) {
+    bullet_manager = manager;
+}
+
+void EnemyManager::shootFromRandomEnemy(Random& random) {     //unable the shoot from random enemies
+    if (!bullet_manager)
+        return;
+
+    if (shooters.empty())
+        return;
+
+    //any live enemy on screen, picked straight from the index
+    ArchetypeId id;
+    int row;
+    if (!entities->resolve(shooters[random.below(static_cast<Uint32>(shooters.size()))], id, row))
+        return;
+    const Archetype& shooter = entities->get(id);
+
+    float bullet_x = shooter.x[row] + shooter.w[row] / 2.0f;
+    float bullet_y = shooter.y[row] + shooter.h[row];
+
+    bullet_manager->shoot(bullet_x, bullet_y);
+}
@@ -0,0 +1,79 @@
+#pragma once
+
+#include <SDL3/SDL_stdinc.h>
+#include <SDL3/SDL_rect.h>
+#include <vector>
+#include "bullet.h"
+#include "random.h"
+#include "entitystore.h"
+#include <iostream>
+#include <fstream>
+#include <string>
+#include <queue>
+
+class EnemyBulletManager;
+
+EnemyType parseEnemyType(const std::string& typeStr);
+
+// An enemy of the level file that is not in the world yet, kept as a small record until it is about to be seen
+struct SpawnRecord {
+    float enter_time;       // level time at which it gets close to the top of the screen
+    float x;
+    float y;                // position at level time 0
+    float w;
+    float h;
+    float speed;
+    EnemyType type;
+};
+
+struct SpawnsLater {
+    bool operator()(const SpawnRecord& a, const SpawnRecord& b) const {
+        return a.enter_time > b.enter_time;
+    }
+};
+
+// Enemy rules over the enemy archetypes of the entity store: loading a level, movement, shooting
+class EnemyManager {
+private:
+    EntityStore* entities;
+    std::priority_queue<SpawnRecord, std::vector<SpawnRecord>, SpawnsLater> spawn_queue;     // soonest first
+    float level_time;
+    int play_area_x;
+    int play_area_width;
+    int screen_height;
+
+    EnemyBulletManager* bullet_manager;
+    std::string enemy_file;
+
+    // kept up to date on spawn, screen entry, death and escape instead of rescanning the enemies
+    int alive_count;
+    int killed_count;
+    int escaped_count;
+    std::vector<EntityHandle> shooters;     // live enemies already on screen, any of them can shoot
+    std::vector<int> shooter_slot;          // per handle index, its place in shooters or -1
+
+    void scheduleEnemy(float x, float y, float w, float h, float speed, EnemyType type);
+    void addShooter(EntityHandle handle);
+    void removeShooter(Uint32 handleIndex);
+    void resetCounters();
+    void spawnDue();
+    void addEnemy(const SpawnRecord& record);
+
+public:
+    EnemyManager(EntityStore* entities);
+
+    // filename parameter added (defaults to old filename for compatibility)
+    void setupEnemies(int play_x, int play_width, int screen_h, const char* filename = "setUpEnemy.txt");
+    void update(float dt);
+    bool damage(ArchetypeId id, int row, int amount);
+    void removeDestroyed();
+    void reset();
+    bool allDestroyed() const;
+    int countAlive() const;
+    int countPending() const;
+    int countKilled() const;
+    int countEscaped() const;
+
+    void setBulletManager(EnemyBulletManager* manager);
+    void shootFromRandomEnemy(Random& random);
+};
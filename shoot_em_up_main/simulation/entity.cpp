@@ -0,0 +1,131 @@
+#include "entity.h"
+
+Entity::Entity(EntityStore* entities, float x, float y, float w, float h, float speed_)
+: entities(entities), handle(NULL_HANDLE), screen_width(800), screen_height(600), offset_x(0) {
+    int row;
+    entities->clear(ArchetypeId::Player);
+    handle = entities->create(ArchetypeId::Player, row);
+    Archetype& player = entities->get(ArchetypeId::Player);
+    player.x[row] = x;
+    player.y[row] = y;
+    player.w[row] = w;
+    player.h[row] = h;
+    player.prev_x[row] = x;
+    player.prev_y[row] = y;
+    player.move_speed[row] = speed_;
+    player.health[row] = 10;
+    player.max_health[row] = 10;
+    player.invulnerable[row] = 0.0f;
+}
+
+Archetype& Entity::columns(int& row) const {        //the player is never destroyed while the game runs, its handle always resolves
+    ArchetypeId id = ArchetypeId::Player;
+    if (!entities->resolve(handle, id, row))
+        row = 0;
+    return entities->get(id);
+}
+
+void Entity::update(const InputFrame& input, float dt) {       //update with movements
+    int row;
+    Archetype& player = columns(row);
+    float& x = player.x[row];
+    float& y = player.y[row];
+    const float w = player.w[row];
+    const float h = player.h[row];
+    const float speed = player.move_speed[row];
+    player.prev_x[row] = x;
+    player.prev_y[row] = y;
+
+  
+    float& invulnerable_timer = player.invulnerable[row];
+    if (invulnerable_timer > 0.0f) {
+        invulnerable_timer -= dt;
+        if (invulnerable_timer < 0.0f) 
+            invulnerable_timer = 0.0f;
+    }
+
+    if (input.up) 
+        y -= speed * dt + 1;
+    if (input.down) 
+        y += speed * dt + 1;
+    if (input.left) 
+        x -= speed * dt + 1;
+    if (input.right) 
+        x += speed * dt + 1;
+
+    //prevent from going off limits 
+    if (x < static_cast<float>(offset_x)) 
+        x = static_cast<float>(offset_x);
+    if (x + w > static_cast<float>(offset_x + screen_width))
+        x = static_cast<float>(offset_x + screen_width) - w;
+    if (y < 0.0f) 
+        y = 0.0f;
+    if (y + h > static_cast<float>(screen_height))
+        y = static_cast<float>(screen_height) - h;
+    
+}
+
+void Entity::setScreenBounds(int width, int height) {       //screen limits
+    screen_width = width;
+    screen_height = height;
+}
+
+void Entity::setOffsetX(int offset) {
+    offset_x = offset;
+}
+
+void Entity::takeDamage(int amount) {       //damage manager
+    if (!isInvulnerable()) {
+        int row;
+        Archetype& player = columns(row);
+        player.health[row] -= amount;
+        if (player.health[row] < 0) player.health[row] = 0;
+        player.invulnerable[row] = 0.5f;
+    }
+}
+
+void Entity::resetPosition(float x, float y) {
+    int row;
+    Archetype& player = columns(row);
+    player.x[row] = x;
+    player.y[row] = y;
+    player.prev_x[row] = x;
+    player.prev_y[row] = y;
+}
+
+void Entity::resetHealth() {
+    int row;
+    Archetype& player = columns(row);
+    player.health[row] = player.max_health[row];
+    player.invulnerable[row] = 0.0f;
+}
+
+SDL_FRect Entity::getRect() const {
+    int row;
+    return columns(row).getRect(row);
+}
+
+SDL_FRect Entity::getPrevRect() const {
+    int row;
+    return columns(row).getPrevRect(row);
+}
+
+int Entity::getHealth() const {
+    int row;
+    return columns(row).health[row];
+}
+
+int Entity::getMaxHealth() const {
+    int row;
+    return columns(row).max_health[row];
+}
+
+float Entity::getInvulnerableTimer() const {
+    int row;
+    return columns(row).invulnerable[row];
+}
+
+bool Entity::isInvulnerable() const {
+    int row;
+    return columns(row).invulnerable[row] > 0.0f;
+}
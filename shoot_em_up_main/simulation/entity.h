@@ -0,0 +1,36 @@
+#pragma once
+
+#include <SDL3/SDL_stdinc.h>
+#include <SDL3/SDL_rect.h>
+#include "input.h"
+#include "entitystore.h"
+
+// The player, its components live in the Player archetype of the entity store.
+// Only the movement bounds, which nothing else reads, are kept here.
+class Entity {
+private:
+    EntityStore* entities;
+    EntityHandle handle;
+    int screen_width;
+    int screen_height;
+    int offset_x;
+
+    Archetype& columns(int& row) const;
+
+public:
+    Entity(EntityStore* entities, float x, float y, float w, float h, float speed_);
+
+    void update(const InputFrame& input, float dt);
+    void setScreenBounds(int width, int height);
+    void setOffsetX(int offset);
+    void takeDamage(int amount);
+    void resetPosition(float x, float y);
+    void resetHealth();
+
+    SDL_FRect getRect() const;
+    SDL_FRect getPrevRect() const;
+    int getHealth() const;
+    int getMaxHealth() const;
+    float getInvulnerableTimer() const;
+    bool isInvulnerable() const;
+};
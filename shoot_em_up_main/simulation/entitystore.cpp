@@ -0,0 +1,107 @@
+#include "entitystore.h"
+
+Archetype::Archetype(ArchetypeId id, Uint32 components) : id(id), components(components), count(0) {
+}
+
+bool Archetype::has(Uint32 mask) const {
+    return (components & mask) == mask;
+}
+
+int Archetype::add() {      //new row with zeroed components, the caller fills it
+    forEachColumn([](auto& column) { column.emplace_back(); });
+    return count++;
+}
+
+void Archetype::remove(int row) {
+    int last = count - 1;
+    forEachColumn([&](auto& column) {
+        column[row] = column[last];
+        column.pop_back();
+    });
+    count--;
+}
+
+SDL_FRect Archetype::getRect(int row) const {
+    return { x[row], y[row], w[row], h[row] };
+}
+
+SDL_FRect Archetype::getPrevRect(int row) const {
+    return { prev_x[row], prev_y[row], w[row], h[row] };
+}
+
+
+EntityStore::EntityStore() : free_head(NULL_HANDLE.index) {
+    const Uint32 enemy = COMPONENT_TRANSFORM | COMPONENT_VELOCITY | COMPONENT_HEALTH | COMPONENT_CONTACT | COMPONENT_KIND;
+    archetypes[static_cast<int>(ArchetypeId::Player)] = Archetype(ArchetypeId::Player, COMPONENT_TRANSFORM | COMPONENT_HEALTH | COMPONENT_CONTROL);
+    archetypes[static_cast<int>(ArchetypeId::Walker)] = Archetype(ArchetypeId::Walker, enemy);
+    archetypes[static_cast<int>(ArchetypeId::Patroller)] = Archetype(ArchetypeId::Patroller, enemy | COMPONENT_PATROL);
+}
+
+Archetype& EntityStore::get(ArchetypeId id) {
+    return archetypes[static_cast<int>(id)];
+}
+
+const Archetype& EntityStore::get(ArchetypeId id) const {
+    return archetypes[static_cast<int>(id)];
+}
+
+EntityHandle EntityStore::create(ArchetypeId id, int& row) {       //row is where the caller fills the components
+    if (free_head == NULL_HANDLE.index) {
+        free_head = static_cast<Uint32>(slots.size());
+        slots.push_back({ id, -1, 0, NULL_HANDLE.index });
+    }
+    Uint32 index = free_head;
+    HandleSlot& slot = slots[index];
+    free_head = slot.next_free;
+
+    Archetype& archetype = get(id);
+    row = archetype.add();
+    archetype.handle[row] = index;
+    slot.archetype = id;
+    slot.row = row;
+    return { index, slot.generation };
+}
+
+void EntityStore::destroy(ArchetypeId id, int row) {        //the last row moves into the hole, its handle is pointed at it
+    Archetype& archetype = get(id);
+    Uint32 index = archetype.handle[row];
+    int last = archetype.count - 1;
+    if (row != last)
+        slots[archetype.handle[last]].row = row;
+    archetype.remove(row);
+
+    HandleSlot& slot = slots[index];
+    slot.row = -1;
+    slot.generation++;      //every handle given out for this entity is now stale
+    slot.next_free = free_head;
+    free_head = index;
+}
+
+bool EntityStore::resolve(EntityHandle handle, ArchetypeId& id, int& row) const {       //false for a stale or null handle
+    if (handle.index >= slots.size())
+        return false;
+    const HandleSlot& slot = slots[handle.index];
+    if (slot.generation != handle.generation || slot.row < 0)
+        return false;
+    id = slot.archetype;
+    row = slot.row;
+    return true;
+}
+
+EntityHandle EntityStore::getHandle(ArchetypeId id, int row) const {
+    Uint32 index = get(id).handle[row];
+    return { index, slots[index].generation };
+}
+
+void EntityStore::clear(ArchetypeId id) {
+    Archetype& archetype = get(id);
+    while (archetype.count > 0)
+        destroy(id, archetype.count - 1);
+}
+
+void EntityStore::clearEnemies() {      //the player stays, it is only reset
+    for (Archetype& archetype : archetypes) {
+        if (archetype.has(COMPONENT_KIND))
+            clear(archetype.id);
+    }
+}
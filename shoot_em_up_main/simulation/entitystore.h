@@ -0,0 +1,144 @@
+#pragma once
+#include <SDL3/SDL_stdinc.h>
+#include <SDL3/SDL_rect.h>
+#include <vector>
+
+enum class EnemyType {
+    tomato,
+    broccoli,
+    carrot
+};
+
+// Components an archetype can have, one bit each. Every entity of an archetype has the same ones.
+enum ComponentBits : Uint32 {
+    COMPONENT_TRANSFORM = 1 << 0,       // x, y, w, h and the position at the previous tick
+    COMPONENT_VELOCITY = 1 << 1,        // vx, vy
+    COMPONENT_PATROL = 1 << 2,          // bounces between min_x and max_x, the sign of vx is the direction
+    COMPONENT_HEALTH = 1 << 3,          // health, max_health
+    COMPONENT_CONTACT = 1 << 4,         // hurts the player once, on touch or when escaping
+    COMPONENT_KIND = 1 << 5,            // enemy type, only read for drawing
+    COMPONENT_CONTROL = 1 << 6          // moved by the player input, invulnerable after a hit
+};
+
+enum class ArchetypeId {
+    Player,
+    Walker,         // enemies going straight down
+    Patroller,      // enemies also going side to side
+    Count
+};
+
+// Stable reference to an entity. The generation changes every time its slot is reused,
+// so a handle kept after the entity is gone resolves to nothing instead of to another entity.
+struct EntityHandle {
+    Uint32 index;
+    Uint32 generation;
+};
+
+static const EntityHandle NULL_HANDLE = { 0xFFFFFFFF, 0 };
+
+// One column per component field, only the columns of the archetype's components are filled.
+// Rows are packed, removing one moves the last row into its place.
+struct Archetype {
+    ArchetypeId id;
+    Uint32 components;
+    int count;
+
+    std::vector<float> x;
+    std::vector<float> y;
+    std::vector<float> w;
+    std::vector<float> h;
+    std::vector<float> prev_x;
+    std::vector<float> prev_y;
+    std::vector<float> vx;
+    std::vector<float> vy;
+    std::vector<float> min_x;
+    std::vector<float> max_x;
+    std::vector<int> health;
+    std::vector<int> max_health;
+    std::vector<Uint8> collided;
+    std::vector<EnemyType> type;
+    std::vector<float> move_speed;
+    std::vector<float> invulnerable;
+    std::vector<Uint32> handle;         // slot in the store's handle table, every archetype has it
+
+    Archetype(ArchetypeId id = ArchetypeId::Count, Uint32 components = 0);
+
+    bool has(Uint32 mask) const;
+    int add();              // use EntityStore::create / destroy, they keep the handles right
+    void remove(int row);
+
+    SDL_FRect getRect(int row) const;
+    SDL_FRect getPrevRect(int row) const;
+
+private:
+    template <typename F>
+    void forEachColumn(F f) {       //only the columns this archetype uses
+        if (components & COMPONENT_TRANSFORM) {
+            f(x); f(y); f(w); f(h); f(prev_x); f(prev_y);
+        }
+        if (components & COMPONENT_VELOCITY) {
+            f(vx); f(vy);
+        }
+        if (components & COMPONENT_PATROL) {
+            f(min_x); f(max_x);
+        }
+        if (components & COMPONENT_HEALTH) {
+            f(health); f(max_health);
+        }
+        if (components & COMPONENT_CONTACT)
+            f(collided);
+        if (components & COMPONENT_KIND)
+            f(type);
+        if (components & COMPONENT_CONTROL) {
+            f(move_speed); f(invulnerable);
+        }
+        f(handle);
+    }
+};
+
+// Every entity of the game world, the player included, grouped by archetype.
+// Systems go through forEach with the components they need and loop over the columns.
+// Entities are created and destroyed through the store so their handles follow them when rows move.
+class EntityStore {
+private:
+    struct HandleSlot {
+        ArchetypeId archetype;
+        int row;                // -1 while free
+        Uint32 generation;
+        Uint32 next_free;
+    };
+
+    Archetype archetypes[static_cast<int>(ArchetypeId::Count)];
+    std::vector<HandleSlot> slots;
+    Uint32 free_head;
+
+public:
+    EntityStore();
+
+    Archetype& get(ArchetypeId id);
+    const Archetype& get(ArchetypeId id) const;
+
+    EntityHandle create(ArchetypeId id, int& row);
+    void destroy(ArchetypeId id, int row);
+    bool resolve(EntityHandle handle, ArchetypeId& id, int& row) const;
+    EntityHandle getHandle(ArchetypeId id, int row) const;
+
+    void clear(ArchetypeId id);
+    void clearEnemies();
+
+    template <typename F>
+    void forEach(Uint32 mask, F f) {
+        for (Archetype& archetype : archetypes) {
+            if (archetype.has(mask) && archetype.count > 0)
+                f(archetype);
+        }
+    }
+
+    template <typename F>
+    void forEach(Uint32 mask, F f) const {
+        for (const Archetype& archetype : archetypes) {
+            if (archetype.has(mask) && archetype.count > 0)
+                f(archetype);
+        }
+    }
+};
@@ -0,0 +1,59 @@
+#include "input.h"
+#include <cstdio>
+#include <fstream>
+#include <sstream>
+#include <string>
+
+InputScript::InputScript() : next(0), current{} {
+}
+
+bool InputScript::load(const char* path) {       //the lines have to be sorted by tick
+    entries.clear();
+    next = 0;
+    current = {};
+
+    std::ifstream file(path);
+    if (!file) {
+        fprintf(stderr, "Error opening input script %s\n", path);
+        return false;
+    }
+
+    std::string line;
+    while (std::getline(file, line)) {
+        if (line.empty() || line[0] == '#')
+            continue;
+
+        std::istringstream words(line);
+        Entry entry = {};
+        if (!(words >> entry.tick)) {
+            fprintf(stderr, "Error reading input script line: %s\n", line.c_str());
+            return false;
+        }
+
+        std::string key;
+        while (words >> key) {
+            if (key == "up")
+                entry.input.up = true;
+            else if (key == "down")
+                entry.input.down = true;
+            else if (key == "left")
+                entry.input.left = true;
+            else if (key == "right")
+                entry.input.right = true;
+            else if (key == "fire")
+                entry.input.fire = true;
+            else
+                fprintf(stderr, "Warning: unknown key %s in input script\n", key.c_str());
+        }
+        entries.push_back(entry);
+    }
+    return true;
+}
+
+InputFrame InputScript::advance(Uint64 tick) {       //ticks are asked in order, so only move forward
+    while (next < entries.size() && entries[next].tick <= tick) {
+        current = entries[next].input;
+        next++;
+    }
+    return current;
+}
@@ -0,0 +1,31 @@
+#pragma once
+#include <SDL3/SDL_stdinc.h>
+#include <vector>
+
+// Player controls sampled for one simulation tick, the simulation never reads the keyboard itself
+struct InputFrame {
+    bool up;
+    bool down;
+    bool left;
+    bool right;
+    bool fire;
+};
+
+// Input replayed from a text file for headless runs, one "<tick> [up] [down] [left] [right] [fire]" per line.
+// A line holds until the next one, lines starting with # are ignored.
+class InputScript {
+private:
+    struct Entry {
+        Uint64 tick;
+        InputFrame input;
+    };
+    std::vector<Entry> entries;
+    size_t next;
+    InputFrame current;
+
+public:
+    InputScript();
+
+    bool load(const char* path);
+    InputFrame advance(Uint64 tick);
+};
@@ -0,0 +1,93 @@
+#pragma once
+#include <SDL3/SDL_stdinc.h>
+#include <vector>
+
+// Object pool over a Storage that keeps its objects packed in [0, size()), so updates only walk live
+// objects. Storage provides resize(n) (keeping the first slots), move(dst, src) and reset(i).
+// Each object also has an id that stays the same while it lives; free ids are chained through the
+// same array that maps live ids to their slot, so acquire and release are O(1).
+template <typename Storage>
+class Pool {
+public:
+    static const Uint32 NONE = 0xFFFFFFFF;
+
+private:
+    Storage storage;
+    std::vector<Uint32> sparse;     // per id: its slot while alive, the next free id otherwise
+    std::vector<Uint32> ids;        // per slot: the id living there
+    Uint32 free_head;
+    int count;
+    int capacity;
+    int max_capacity;               // growth stops here, 0 grows without limit
+
+    bool grow() {       //doubles the capacity, new ids go to the free list
+        if (max_capacity > 0 && capacity >= max_capacity)
+            return false;
+        int newCapacity = capacity > 0 ? capacity * 2 : 32;
+        if (max_capacity > 0 && newCapacity > max_capacity)
+            newCapacity = max_capacity;
+        reserve(newCapacity);
+        return true;
+    }
+
+    void reserve(int newCapacity) {
+        storage.resize(newCapacity);
+        sparse.resize(newCapacity);
+        ids.resize(newCapacity);
+        for (int id = newCapacity - 1; id >= capacity; id--) {
+            sparse[id] = free_head;
+            free_head = static_cast<Uint32>(id);
+        }
+        capacity = newCapacity;
+    }
+
+public:
+    // maxCapacity == capacity keeps a fixed size, acquire fails once it is full
+    Pool(int initialCapacity = 0, int maxCapacity = 0) : free_head(NONE), count(0), capacity(0), max_capacity(maxCapacity) {
+        if (initialCapacity > 0)
+            reserve(initialCapacity);
+    }
+
+    int acquire() {     //slot of the new object, -1 when full and not allowed to grow
+        if (free_head == NONE && !grow())
+            return -1;
+        Uint32 id = free_head;
+        free_head = sparse[id];
+
+        int slot = count++;
+        sparse[id] = static_cast<Uint32>(slot);
+        ids[slot] = id;
+        return slot;
+    }
+
+    void release(int slot) {        //the last object moves into the hole to keep the range packed
+        int last = --count;
+        Uint32 id = ids[slot];
+        if (slot != last) {
+            storage.move(slot, last);
+            ids[slot] = ids[last];
+            sparse[ids[slot]] = static_cast<Uint32>(slot);
+        }
+        storage.reset(last);
+
+        sparse[id] = free_head;
+        free_head = id;
+    }
+
+    void clear() {
+        while (count > 0)
+            release(count - 1);
+    }
+
+    int size() const {
+        return count;
+    }
+
+    Storage& get() {
+        return storage;
+    }
+
+    const Storage& get() const {
+        return storage;
+    }
+};
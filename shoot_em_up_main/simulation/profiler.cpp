@@ -0,0 +1,123 @@
+#include "profiler.h"
+#include <chrono>
+#include <cstdio>
+#include <format>
+#include <fstream>
+#include <mutex>
+#include <string>
+
+static const size_t RING_CAPACITY = 1 << 16;        //about a second of a busy simulation thread
+
+//every ring ever made, only locked when a thread makes its ring and when dumping
+static std::mutex ringsMutex;
+static std::vector<ProfileRing*> rings;
+
+ProfileRing::ProfileRing(int threadId, size_t capacity) : events(capacity), written(0), mask(capacity - 1), threadId(threadId), threadName(nullptr) {
+}
+
+void ProfileRing::push(const char* name, Uint64 start, Uint64 end) {
+    Uint64 index = written.load(std::memory_order_relaxed);
+    Slot& slot = events[index & mask];
+    slot.name.store(name, std::memory_order_relaxed);
+    slot.start_ns.store(start, std::memory_order_relaxed);
+    slot.end_ns.store(end, std::memory_order_relaxed);
+    written.store(index + 1, std::memory_order_release);        //the event is complete before it is counted
+}
+
+void ProfileRing::copyEvents(std::vector<ProfileEvent>& out) const {      //events the writer reused during the copy are left out
+    Uint64 end = written.load(std::memory_order_acquire);
+    Uint64 begin = end > events.size() ? end - events.size() : 0;
+    std::vector<ProfileEvent> copy;
+    copy.reserve(static_cast<size_t>(end - begin));
+    for (Uint64 i = begin; i < end; i++) {
+        const Slot& slot = events[i & mask];
+        copy.push_back({ slot.name.load(std::memory_order_relaxed), slot.start_ns.load(std::memory_order_relaxed), slot.end_ns.load(std::memory_order_relaxed) });
+    }
+
+    //push() fills the slot of event "after" before counting it, so that slot may be half written too
+    std::atomic_thread_fence(std::memory_order_acquire);
+    Uint64 after = written.load(std::memory_order_relaxed);
+    Uint64 safe = after + 1 > events.size() ? after + 1 - events.size() : 0;
+    for (Uint64 i = SDL_max(begin, safe); i < end; i++)
+        out.push_back(copy[static_cast<size_t>(i - begin)]);
+}
+
+void ProfileRing::setName(const char* name) {
+    threadName = name;
+}
+
+const char* ProfileRing::getName() const {
+    return threadName;
+}
+
+int ProfileRing::getId() const {
+    return threadId;
+}
+
+Uint64 Profiler::now() {        //monotonic, the library does not depend on the SDL timer
+    return static_cast<Uint64>(std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now().time_since_epoch()).count());
+}
+
+ProfileRing& Profiler::threadRing() {
+    thread_local ProfileRing* ring = nullptr;
+    if (!ring) {
+        std::lock_guard<std::mutex> lock(ringsMutex);
+        ring = new ProfileRing(static_cast<int>(rings.size()), RING_CAPACITY);     //never deleted, a dump can come after the thread ended
+        rings.push_back(ring);
+    }
+    return *ring;
+}
+
+void Profiler::nameThread(const char* name) {
+    threadRing().setName(name);
+}
+
+bool Profiler::writeChromeTrace(const char* path) {       //complete events ("X") in microseconds from the first event
+    std::vector<ProfileEvent> events;
+    std::vector<std::pair<const ProfileRing*, size_t>> ends;       //where each thread's events stop
+    {
+        std::lock_guard<std::mutex> lock(ringsMutex);
+        for (const ProfileRing* ring : rings) {
+            ring->copyEvents(events);
+            ends.push_back({ ring, events.size() });
+        }
+    }
+
+    Uint64 origin = ~0ull;
+    for (const ProfileEvent& event : events)
+        origin = SDL_min(origin, event.start_ns);
+
+    std::ofstream file(path);
+    if (!file) {
+        fprintf(stderr, "Error opening %s\n", path);
+        return false;
+    }
+
+    std::string json = "{\"displayTimeUnit\":\"ns\",\"traceEvents\":[\n";
+    bool first = true;
+    size_t begin = 0;
+    for (const auto& [ring, end] : ends) {
+        std::string name = ring->getName() ? ring->getName() : std::format("thread {}", ring->getId());
+        json += std::format("{}{{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":1,\"tid\":{},\"args\":{{\"name\":\"{}\"}}}}", first ? "" : ",\n", ring->getId(), name);
+        first = false;
+        for (size_t i = begin; i < end; i++) {
+            const ProfileEvent& event = events[i];
+            json += std::format(",\n{{\"name\":\"{}\",\"ph\":\"X\",\"pid\":1,\"tid\":{},\"ts\":{:.3f},\"dur\":{:.3f}}}", event.name, ring->getId(),
+                (event.start_ns - origin) / 1000.0, (event.end_ns - event.start_ns) / 1000.0);
+            if (json.size() > (1 << 20)) {      //written a megabyte at a time
+                file << json;
+                json.clear();
+            }
+        }
+        begin = end;
+    }
+    json += "\n]}\n";
+    file << json;
+
+    if (!file) {
+        fprintf(stderr, "Error writing %s\n", path);
+        return false;
+    }
+    printf("profile_saved: %s (%zu events)\n", path, events.size());
+    return true;
+}
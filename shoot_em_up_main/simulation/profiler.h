@@ -0,0 +1,76 @@
+#pragma once
+#include <SDL3/SDL_stdinc.h>
+#include <atomic>
+#include <vector>
+
+// Frame profiler: scoped zones with nanosecond timestamps, kept per thread in a lock-free ring and written
+// as a Chrome trace (chrome://tracing or ui.perfetto.dev). The zones exist in debug builds and in builds
+// that define ENABLE_PROFILER, everywhere else the macros compile to nothing.
+#if defined(_DEBUG) || defined(ENABLE_PROFILER)
+#define PROFILER_ENABLED 1
+#else
+#define PROFILER_ENABLED 0
+#endif
+
+struct ProfileEvent {
+    const char* name;       // a string literal, only the pointer is kept
+    Uint64 start_ns;
+    Uint64 end_ns;
+};
+
+// Last events of one thread. Only that thread writes, the oldest events are overwritten once it is full.
+// A dump from another thread copies it without stopping the writer and drops every slot the writer may have
+// touched meanwhile. The slot fields are relaxed atomics so that copy is not a data race, a slot being rewritten
+// can still mix two events, that is why those slots are dropped.
+class ProfileRing {
+private:
+    struct Slot {
+        std::atomic<const char*> name;
+        std::atomic<Uint64> start_ns;
+        std::atomic<Uint64> end_ns;
+    };
+
+    std::vector<Slot> events;               // power of two size
+    std::atomic<Uint64> written;            // events ever pushed, the next one goes to written & mask
+    Uint64 mask;
+    int threadId;
+    const char* threadName;
+
+public:
+    ProfileRing(int threadId, size_t capacity);
+
+    void push(const char* name, Uint64 start, Uint64 end);
+    void copyEvents(std::vector<ProfileEvent>& out) const;      // oldest first
+
+    void setName(const char* name);
+    const char* getName() const;
+    int getId() const;
+};
+
+class Profiler {
+public:
+    static Uint64 now();
+    static ProfileRing& threadRing();       // made on the first zone of each thread, kept after the thread ends
+    static void nameThread(const char* name);
+    static bool writeChromeTrace(const char* path);
+};
+
+class ProfileZone {
+private:
+    const char* name;
+    Uint64 start;
+
+public:
+    ProfileZone(const char* name) : name(name), start(Profiler::now()) {}
+    ~ProfileZone() { Profiler::threadRing().push(name, start, Profiler::now()); }
+};
+
+#if PROFILER_ENABLED
+#define PROFILE_CONCAT_INNER(a, b) a##b
+#define PROFILE_CONCAT(a, b) PROFILE_CONCAT_INNER(a, b)
+#define PROFILE_ZONE(name) ProfileZone PROFILE_CONCAT(profileZone, __LINE__)(name)     // until the end of the enclosing scope
+#define PROFILE_THREAD(name) Profiler::nameThread(name)
+#else
+#define PROFILE_ZONE(name) ((void)0)
+#define PROFILE_THREAD(name) ((void)0)
+#endif
@@ -0,0 +1,25 @@
+#include "random.h"
+
+Random::Random(Uint64 seed) : state(0) {
+    this->seed(seed);
+}
+
+void Random::seed(Uint64 value) {       //splitmix64 spreads any seed, 0 included, over a non zero state
+    Uint64 z = value + 0x9E3779B97F4A7C15ull;
+    z = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9ull;
+    z = (z ^ (z >> 27)) * 0x94D049BB133111EBull;
+    state = z ^ (z >> 31);
+    if (state == 0)
+        state = 0x9E3779B97F4A7C15ull;
+}
+
+Uint32 Random::next() {
+    state ^= state >> 12;
+    state ^= state << 25;
+    state ^= state >> 27;
+    return static_cast<Uint32>((state * 0x2545F4914F6CDD1Dull) >> 32);
+}
+
+Uint32 Random::below(Uint32 bound) {        //multiply and shift instead of a modulo, close enough to uniform for a shooter pick
+    return static_cast<Uint32>((static_cast<Uint64>(next()) * bound) >> 32);
+}
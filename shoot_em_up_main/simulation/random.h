@@ -0,0 +1,16 @@
+#pragma once
+#include <SDL3/SDL_stdinc.h>
+
+// Seedable generator owned by the world, so a seed and the same inputs always give the same game.
+// xorshift64* seeded through splitmix64: the sequence is the same on every compiler and platform.
+class Random {
+private:
+    Uint64 state;
+
+public:
+    Random(Uint64 seed = 1);
+
+    void seed(Uint64 value);
+    Uint32 next();
+    Uint32 below(Uint32 bound);     // in [0, bound), bound has to be above 0
+};
@@ -0,0 +1,234 @@
+#include "replay.h"
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+
+static const char REPLAY_MAGIC[4] = { 'B', 'G', 'R', 'P' };
+static const Uint32 REPLAY_VERSION = 1;
+
+//the values are written as they are in memory, little endian: the game only targets x86 and x64
+template <typename T>
+static void writeValue(std::ofstream& file, const T& value) {
+    file.write(reinterpret_cast<const char*>(&value), sizeof(T));
+}
+
+template <typename T>
+static bool readValue(std::ifstream& file, T& value) {
+    file.read(reinterpret_cast<char*>(&value), sizeof(T));
+    return static_cast<bool>(file);
+}
+
+static Uint8 packKeys(const InputFrame& input) {
+    return static_cast<Uint8>((input.up ? 1 : 0) | (input.down ? 2 : 0) | (input.left ? 4 : 0) | (input.right ? 8 : 0) | (input.fire ? 16 : 0));
+}
+
+static InputFrame unpackKeys(Uint8 keys) {
+    InputFrame input = {};
+    input.up = (keys & 1) != 0;
+    input.down = (keys & 2) != 0;
+    input.left = (keys & 4) != 0;
+    input.right = (keys & 8) != 0;
+    input.fire = (keys & 16) != 0;
+    return input;
+}
+
+Replay::Replay() : seed(1), tickRate(60), level(1), bounds{}, ticks(0), finalScore(0), finalHealth(0), playTick(0), nextRun(0), runTicks(0), nextCommand(0) {
+}
+
+void Replay::begin(const World& world, int ticksPerSecond) {
+    seed = world.getSeed();
+    tickRate = ticksPerSecond;
+    level = world.getLevel();
+    bounds = world.getBounds();
+    ticks = 0;
+    finalScore = 0;
+    finalHealth = 0;
+    runs.clear();
+    commands.clear();
+}
+
+void Replay::recordCommand(const WorldCommand& command) {
+    commands.push_back({ ticks, command });
+}
+
+void Replay::recordTick(const InputFrame& input) {      //a new run only when the keys change
+    Uint8 keys = packKeys(input);
+    if (!runs.empty() && runs.back().keys == keys && runs.back().length < 0xFFFFFFFFu)
+        runs.back().length++;
+    else
+        runs.push_back({ 1, keys });
+    ticks++;
+}
+
+void Replay::finish(const World& world) {
+    finalScore = world.getState().getScore();
+    finalHealth = world.getPlayer().getHealth();
+}
+
+bool Replay::save(const char* path) const {
+    std::ofstream file(path, std::ios::binary);
+    if (!file) {
+        fprintf(stderr, "Error opening replay %s\n", path);
+        return false;
+    }
+
+    file.write(REPLAY_MAGIC, sizeof(REPLAY_MAGIC));
+    writeValue(file, REPLAY_VERSION);
+    writeValue(file, seed);
+    writeValue(file, static_cast<Sint32>(tickRate));
+    writeValue(file, static_cast<Sint32>(level));
+    writeValue(file, static_cast<Sint32>(bounds.x));
+    writeValue(file, static_cast<Sint32>(bounds.width));
+    writeValue(file, static_cast<Sint32>(bounds.height));
+    writeValue(file, ticks);
+    writeValue(file, static_cast<Sint32>(finalScore));
+    writeValue(file, static_cast<Sint32>(finalHealth));
+
+    writeValue(file, static_cast<Uint32>(runs.size()));
+    for (const InputRun& run : runs) {
+        writeValue(file, run.length);
+        writeValue(file, run.keys);
+    }
+
+    writeValue(file, static_cast<Uint32>(commands.size()));
+    for (const CommandEntry& entry : commands) {
+        writeValue(file, entry.tick);
+        writeValue(file, static_cast<Uint8>(entry.command.type));
+        writeValue(file, static_cast<Sint32>(entry.command.level));
+        writeValue(file, static_cast<Sint32>(entry.command.bounds.x));
+        writeValue(file, static_cast<Sint32>(entry.command.bounds.width));
+        writeValue(file, static_cast<Sint32>(entry.command.bounds.height));
+    }
+
+    if (!file) {
+        fprintf(stderr, "Error writing replay %s\n", path);
+        return false;
+    }
+    return true;
+}
+
+bool Replay::load(const char* path) {
+    std::ifstream file(path, std::ios::binary);
+    if (!file) {
+        fprintf(stderr, "Error opening replay %s\n", path);
+        return false;
+    }
+
+    char magic[4];
+    Uint32 version = 0;
+    file.read(magic, sizeof(magic));
+    if (!file || std::memcmp(magic, REPLAY_MAGIC, sizeof(magic)) != 0 || !readValue(file, version) || version != REPLAY_VERSION) {
+        fprintf(stderr, "Error: %s is not a replay of this version\n", path);
+        return false;
+    }
+
+    Sint32 rate, startLevel, x, width, height, score, health;
+    Uint32 runCount, commandCount;
+    bool valid = readValue(file, seed) && readValue(file, rate) && readValue(file, startLevel) && readValue(file, x) && readValue(file, width) && readValue(file, height) &&
+        readValue(file, ticks) && readValue(file, score) && readValue(file, health) && readValue(file, runCount);
+    if (!valid || rate < 1) {
+        fprintf(stderr, "Error reading replay header %s\n", path);
+        return false;
+    }
+    tickRate = rate;
+    level = startLevel;
+    bounds = { x, width, height };
+    finalScore = score;
+    finalHealth = health;
+
+    runs.clear();
+    Uint64 runTotal = 0;
+    for (Uint32 i = 0; i < runCount; i++) {
+        InputRun run;
+        if (!readValue(file, run.length) || !readValue(file, run.keys)) {
+            fprintf(stderr, "Error reading replay inputs %s\n", path);
+            return false;
+        }
+        runs.push_back(run);
+        runTotal += run.length;
+    }
+
+    commands.clear();
+    if (!readValue(file, commandCount)) {
+        fprintf(stderr, "Error reading replay commands %s\n", path);
+        return false;
+    }
+    for (Uint32 i = 0; i < commandCount; i++) {
+        CommandEntry entry = {};
+        Uint8 type;
+        Sint32 commandLevel, commandX, commandWidth, commandHeight;
+        if (!readValue(file, entry.tick) || !readValue(file, type) || !readValue(file, commandLevel) || !readValue(file, commandX) || !readValue(file, commandWidth) || !readValue(file, commandHeight) ||
+            type > static_cast<Uint8>(WorldCommand::Type::Resize)) {
+            fprintf(stderr, "Error reading replay commands %s\n", path);
+            return false;
+        }
+        entry.command = { static_cast<WorldCommand::Type>(type), commandLevel, { commandX, commandWidth, commandHeight } };
+        commands.push_back(entry);
+    }
+
+    if (runTotal != ticks) {
+        fprintf(stderr, "Error: replay %s holds %llu ticks of input for %llu ticks\n", path, static_cast<unsigned long long>(runTotal), static_cast<unsigned long long>(ticks));
+        return false;
+    }
+    return true;
+}
+
+void Replay::start(World& world) {      //back to the state begin() saw
+    world.setSeed(seed);
+    world.loadLevel(level);
+    playTick = 0;
+    nextRun = 0;
+    runTicks = 0;
+    nextCommand = 0;
+}
+
+bool Replay::advance(World& world) {
+    if (playTick >= ticks)
+        return false;
+
+    while (nextCommand < commands.size() && commands[nextCommand].tick <= playTick) {
+        world.apply(commands[nextCommand].command);
+        nextCommand++;
+    }
+
+    while (runTicks >= runs[nextRun].length) {      //load() checked that the runs cover every tick
+        nextRun++;
+        runTicks = 0;
+    }
+    world.step(unpackKeys(runs[nextRun].keys), 1.0f / tickRate);
+    runTicks++;
+    playTick++;
+    return true;
+}
+
+bool Replay::matches(const World& world) const {
+    return world.getState().getScore() == finalScore && world.getPlayer().getHealth() == finalHealth;
+}
+
+Uint64 Replay::getSeed() const {
+    return seed;
+}
+
+int Replay::getTickRate() const {
+    return tickRate;
+}
+
+int Replay::getLevel() const {
+    return level;
+}
+
+PlayBounds Replay::getBounds() const {
+    return bounds;
+}
+
+Uint64 Replay::getTicks() const {
+    return ticks;
+}
+
+int Replay::getFinalScore() const {
+    return finalScore;
+}
+
+int Replay::getFinalHealth() const {
+    return finalHealth;
+}
@@ -0,0 +1,60 @@
+#pragma once
+#include <SDL3/SDL_stdinc.h>
+#include <vector>
+#include "input.h"
+#include "world.h"
+
+// A run that can be played again tick for tick: the seed, tick rate, level and play area it started from,
+// the input of every tick, the commands and the score and health it ended with.
+// Saved as a small binary file, the inputs are run length encoded since they rarely change between ticks.
+class Replay {
+private:
+    struct InputRun {
+        Uint32 length;      // ticks in a row with these keys
+        Uint8 keys;         // one bit per key, see packKeys
+    };
+    struct CommandEntry {
+        Uint64 tick;        // applied just before this tick
+        WorldCommand command;
+    };
+
+    Uint64 seed;
+    int tickRate;
+    int level;
+    PlayBounds bounds;
+    Uint64 ticks;
+    int finalScore;
+    int finalHealth;
+    std::vector<InputRun> runs;
+    std::vector<CommandEntry> commands;
+
+    // playback position
+    Uint64 playTick;
+    size_t nextRun;
+    Uint32 runTicks;        // ticks already played from runs[nextRun]
+    size_t nextCommand;
+
+public:
+    Replay();
+
+    // recording, begin() has to be called on a world that has just loaded its level
+    void begin(const World& world, int ticksPerSecond);
+    void recordCommand(const WorldCommand& command);        // before the recordTick() of the tick it applies to
+    void recordTick(const InputFrame& input);
+    void finish(const World& world);
+    bool save(const char* path) const;
+
+    // playback, the world has to be built with getBounds() and have its level order loaded
+    bool load(const char* path);
+    void start(World& world);
+    bool advance(World& world);         // plays the next tick, false once every recorded tick is played
+    bool matches(const World& world) const;
+
+    Uint64 getSeed() const;
+    int getTickRate() const;
+    int getLevel() const;
+    PlayBounds getBounds() const;
+    Uint64 getTicks() const;
+    int getFinalScore() const;
+    int getFinalHealth() const;
+};
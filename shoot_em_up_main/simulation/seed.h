@@ -0,0 +1,18 @@
+#pragma once
+#include <cerrno>
+#include <cstdint>
+#include <cstdlib>
+
+// Seed given on a command line: digits only, any 64 bit value, so every seed a replay stores can be typed back.
+// Shared by the game, the batch runner and levelgen; it needs no SDL so levelgen can include it without the library.
+inline bool parseSeed(const char* text, std::uint64_t& value) {
+    if (!text || *text < '0' || *text > '9')        //strtoull would take a sign or spaces
+        return false;
+    char* end = nullptr;
+    errno = 0;
+    unsigned long long parsed = std::strtoull(text, &end, 10);
+    if (*end != '\0' || errno == ERANGE)
+        return false;
+    value = parsed;
+    return true;
+}
@@ -0,0 +1,407 @@
+#include "world.h"
+#include "profiler.h"
+#include <bit>
+#include <chrono>
+#include <fstream>
+
+static const float GRID_CELL_SIZE = 64.0f;      //about the size of an enemy
+
+static Uint64 nowNS() {     //monotonic, the library does not depend on the SDL timer
+    return static_cast<Uint64>(std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now().time_since_epoch()).count());
+}
+
+World::World(const PlayBounds& bounds) : entities(nullptr), collisionGrid(nullptr), player(nullptr), bulletManager(nullptr), enemyBulletManager(nullptr), enemyManager(nullptr), gameState(nullptr),
+bounds(bounds), initialPlayerX(0.0f), initialPlayerY(0.0f), currentLevel(1), tick(0), seed(1), random(1), timingEnabled(false), timings{} {
+    initialPlayerX = bounds.x + bounds.width / 2.0f - 50.0f;
+    initialPlayerY = bounds.height - 150.0f;
+
+    //set up the parameters and classes associated
+    entities = new EntityStore();
+    collisionGrid = new CollisionGrid();
+    player = new Entity(entities, initialPlayerX, initialPlayerY, 80.0f, 100.0f, 200.0f);
+    bulletManager = new PlayerBulletManager(100, 0.1f);
+    enemyBulletManager = new EnemyBulletManager(200, 0.5f);
+    enemyManager = new EnemyManager(entities);
+    gameState = new GameState();
+
+    player->setScreenBounds(bounds.width, bounds.height);
+    player->setOffsetX(bounds.x);
+    enemyManager->setBulletManager(enemyBulletManager);
+}
+
+World::~World() {
+    delete player;
+    delete bulletManager;
+    delete enemyBulletManager;
+    delete enemyManager;
+    delete collisionGrid;
+    delete entities;        //after everything that points into it
+    delete gameState;
+}
+
+bool World::loadLevelOrder(const char* path) {
+    levelOrder.clear();
+    std::ifstream file(path);
+    std::string currentLine;
+
+    while (std::getline(file, currentLine)) {
+        if (currentLine.empty())
+            continue;
+
+        std::string level1, level2;
+        std::getline(file, level1);
+        std::getline(file, level2);
+        levelOrder.push_back(level1);
+        levelOrder.push_back(level2);
+    }
+    return true;
+}
+
+std::string World::getLevelFilename(int level) const {
+    int index = level - 1;
+
+    if (index >= 0 && index < levelOrder.size())
+        return levelOrder[index];
+
+    return "";
+}
+
+void World::loadLevel(int level) {
+    // clamp level between 1 and 2
+    if (level < 1) level = 1;
+    if (level > 2) level = 2;
+    currentLevel = level;
+    loadLevelFile(getLevelFilename(currentLevel));
+}
+
+void World::loadLevelFile(const std::string& filename) {      //any enemy file, the level number is left as it is
+    PROFILE_ZONE("World::loadLevelFile");
+    levelFile = filename;
+
+    // reset player position & health
+    player->resetPosition(initialPlayerX, initialPlayerY);
+    player->resetHealth();
+
+    // recreate bullet managers
+    delete enemyBulletManager;
+    delete bulletManager;
+    bulletManager = new PlayerBulletManager(100, 0.1f);
+    enemyBulletManager = new EnemyBulletManager(200, 0.5f);
+
+    // load enemy file for chosen level
+    enemyManager->setupEnemies(bounds.x, bounds.width, bounds.height, levelFile.c_str());
+    enemyManager->setBulletManager(enemyBulletManager);
+
+    // reset game state (clears victory/pause/game over)
+    gameState->reset();
+}
+
+void World::reset() {       //restart the current level from its file
+    loadLevelFile(levelFile);
+}
+
+void World::step(const InputFrame& input, float dt) {       //one simulation tick, nothing moves while paused or over
+    PROFILE_ZONE("World::step");
+    tick++;
+    if (!gameState->isActive())
+        return;
+
+    Uint64 mark = timingEnabled ? nowNS() : 0;
+    {
+        PROFILE_ZONE("World::player");
+        player->update(input, dt);
+
+        if (input.fire) {                //the bullets are updated
+            float bullet_x = player->getRect().x + (player->getRect().w / 2.0f) - 2.5f;     //bullet adjusted correctly
+            float bullet_y = player->getRect().y;
+            bulletManager->shoot(bullet_x, bullet_y);
+        }
+    }
+    lap(timings.player_ns, mark);
+
+    //every updates about the bullets and the enemies
+    //bullets die when they leave the play area, whatever side they leave by
+    const SDL_FRect area = { static_cast<float>(bounds.x), 0.0f, static_cast<float>(bounds.width), static_cast<float>(bounds.height) };
+    {
+        PROFILE_ZONE("World::playerBullets");
+        bulletManager->update(dt);
+        bulletManager->updateBullets(dt, area);
+    }
+    lap(timings.bullets_ns, mark);
+    {
+        PROFILE_ZONE("World::enemies");
+        enemyManager->update(dt);
+    }
+    lap(timings.enemies_ns, mark);
+    {
+        PROFILE_ZONE("World::enemyBullets");
+        enemyBulletManager->update(dt);
+        enemyBulletManager->updateBullets(dt, area);
+    }
+    lap(timings.bullets_ns, mark);
+
+    //update the collisions handled
+    handleCollisions();
+    lap(timings.collisions_ns, mark);
+    {
+        PROFILE_ZONE("World::cleanup");
+        enemyManager->removeDestroyed();
+
+        if (player->getHealth() <= 0)
+            handleGameOver();       //toggle game over if health bellow 0
+
+        if (enemyManager->allDestroyed())
+            handleVictory();        //toggle victory if all enemies dead/out of screen and hp remaining for the player
+    }
+    lap(timings.cleanup_ns, mark);
+}
+
+void World::apply(const WorldCommand& command) {
+    switch (command.type) {
+    case WorldCommand::Type::Reset:
+        reset();
+        break;
+    case WorldCommand::Type::TogglePause:
+        togglePause();
+        break;
+    case WorldCommand::Type::Resume:
+        resume();
+        break;
+    case WorldCommand::Type::LoadLevel:
+        loadLevel(command.level);
+        break;
+    case WorldCommand::Type::Resize:
+        setBounds(command.bounds);
+        break;
+    }
+}
+
+void World::lap(Uint64& phase, Uint64& mark) const {        //charge the time since mark to a phase, the next phase starts now
+    if (!timingEnabled)
+        return;
+    Uint64 now = nowNS();
+    phase += now - mark;
+    mark = now;
+}
+
+void World::setBounds(const PlayBounds& newBounds) {       //the play area changed size, the player stays inside the new one
+    bounds = newBounds;
+    player->setScreenBounds(bounds.width, bounds.height);
+    player->setOffsetX(bounds.x);
+}
+
+void World::togglePause() {
+    if (!gameState->isGameOver() && !gameState->isVictory())
+        gameState->togglePause();
+}
+
+void World::resume() {
+    gameState->setPaused(false);
+}
+
+void World::setSeed(Uint64 value) {
+    seed = value;
+    random.seed(value);
+}
+
+Uint64 World::getSeed() const {
+    return seed;
+}
+
+void World::setTimingEnabled(bool enabled) {
+    timingEnabled = enabled;
+}
+
+void World::resetTimings() {
+    timings = {};
+}
+
+const StepTimings& World::getTimings() const {
+    return timings;
+}
+
+void World::handleCollisions() {     // handle all collisions in the game
+    PROFILE_ZONE("World::handleCollisions");
+    buildCollisionGrid();
+    checkBulletEnemyCollisions();
+    checkPlayerEnemyCollisions();
+    checkPlayerBulletCollisions();
+}
+
+void World::buildCollisionGrid() {       //one pass over the enemies: the escaped ones hurt the player, the others go in the grid
+    PROFILE_ZONE("World::buildCollisionGrid");
+    const SDL_FRect area = { static_cast<float>(bounds.x), 0.0f, static_cast<float>(bounds.width), static_cast<float>(bounds.height) };
+    collisionGrid->setArea(area, GRID_CELL_SIZE);
+    collisionGrid->clear();
+
+    const float bottom = area.y + area.h;
+    entities->forEach(COMPONENT_TRANSFORM | COMPONENT_HEALTH | COMPONENT_CONTACT, [&](Archetype& enemies) {
+        for (int e = 0; e < enemies.count; e++) {
+            if (enemies.health[e] <= 0)
+                continue;
+            if (enemies.y[e] > bottom) {
+                if (!enemies.collided[e]) {      //if an enemy escapes, the player loses 1hp for not killing it
+                    player->takeDamage(1);
+                    enemies.collided[e] = 1;
+                }
+                continue;
+            }
+            //the whole move of the tick, so a bullet path crossing it finds it
+            collisionGrid->insert(sweptBounds(enemies.getPrevRect(e), enemies.getRect(e)), LAYER_ENEMY, static_cast<int>(enemies.id), e);
+        }
+    });
+    collisionGrid->build();
+}
+
+void World::checkBulletEnemyCollisions() {       //count the collision between the enemy and the bullet under some conditions
+    PROFILE_ZONE("World::checkBulletEnemyCollisions");
+    BulletColumns& bullets = bulletManager->getBullets();
+    for (int i = 0; i < bulletManager->getCount(); i++) {
+        if (!bullets.isActive(i))
+            continue;
+
+        //the bullet is tested along its whole move of the tick, not only where it ended
+        const SDL_FRect from = bullets.getPrevRect(i);
+        const SDL_FRect to = bullets.getRect(i);
+        const SDL_FRect path = sweptBounds(from, to);
+        candidates.clear();
+        collisionGrid->query(path, LAYER_ENEMY, [&](const GridItem& item) {
+            if (entities->get(static_cast<ArchetypeId>(item.group)).health[item.index] > 0)
+                candidates.push(item.rect, item.group, item.index);
+            return false;
+        });
+
+        //the batch keeps the enemies whose move crosses the path, the exact sweep orders them, first hit wins
+        int first = -1;
+        float firstTime = 2.0f;
+        for (int start = 0; start < candidates.size(); start += AABB_BATCH_MAX) {
+            Uint32 hits = testAABBs(path, &candidates.x[start], &candidates.y[start], &candidates.w[start], &candidates.h[start], candidates.size() - start);
+            for (; hits; hits &= hits - 1) {
+                int k = start + std::countr_zero(hits);
+                const Archetype& enemies = entities->get(static_cast<ArchetypeId>(candidates.group[k]));
+                int e = candidates.index[k];
+                float dx = (to.x - from.x) - (enemies.x[e] - enemies.prev_x[e]);      //motion relative to the enemy
+                float dy = (to.y - from.y) - (enemies.y[e] - enemies.prev_y[e]);
+                float time;
+                if (sweepAABB(from, dx, dy, enemies.getPrevRect(e), time) && time < firstTime) {
+                    first = k;
+                    firstTime = time;
+                }
+            }
+        }
+        if (first < 0)
+            continue;
+
+        //the enemy is damaged 2hp if collision, and the bullet deactivate
+        bullets.deactivate(i);
+        if (enemyManager->damage(static_cast<ArchetypeId>(candidates.group[first]), candidates.index[first], 2))
+            gameState->addScore(10);
+    }
+}
+
+void World::checkPlayerEnemyCollisions() {        //check if the player collides with the enemy
+    PROFILE_ZONE("World::checkPlayerEnemyCollisions");
+    const SDL_FRect playerRect = player->getRect();
+    candidates.clear();
+    collisionGrid->query(playerRect, LAYER_ENEMY, [&](const GridItem& item) {
+        Archetype& enemies = entities->get(static_cast<ArchetypeId>(item.group));
+        if (!enemies.collided[item.index] && enemies.health[item.index] > 0)
+            candidates.push(enemies.getRect(item.index), item.group, item.index);
+        return false;
+    });
+
+    for (int start = 0; start < candidates.size(); start += AABB_BATCH_MAX) {
+        Uint32 hits = testAABBs(playerRect, &candidates.x[start], &candidates.y[start], &candidates.w[start], &candidates.h[start], candidates.size() - start);
+        for (; hits; hits &= hits - 1) {
+            int hit = start + std::countr_zero(hits);
+            player->takeDamage(3);      //the player loses 3hp if collided with an enemy
+            entities->get(static_cast<ArchetypeId>(candidates.group[hit])).collided[candidates.index[hit]] = 1;    //cannot collide with this enemy again
+        }
+    }
+    if (enemyBulletManager->canShoot())
+        enemyManager->shootFromRandomEnemy(random);
+}
+
+void World::checkPlayerBulletCollisions() {       //check collision between the enemy's bullet and the player
+    PROFILE_ZONE("World::checkPlayerBulletCollisions");
+    const SDL_FRect playerFrom = player->getPrevRect();
+    const SDL_FRect playerTo = player->getRect();
+    const SDL_FRect playerPath = sweptBounds(playerFrom, playerTo);
+    BulletColumns& enemyBullets = enemyBulletManager->getBullets();
+
+    //a mask word of bullets at a time: their paths against the player's path, then the exact sweep on those
+    float pathX[BULLET_MASK_BITS];
+    float pathY[BULLET_MASK_BITS];
+    float pathW[BULLET_MASK_BITS];
+    float pathH[BULLET_MASK_BITS];
+    for (int base = 0; base < enemyBulletManager->getCount(); base += BULLET_MASK_BITS) {
+        Uint32 hits = enemyBullets.active[base / BULLET_MASK_BITS];
+        if (!hits)
+            continue;
+        for (int k = 0; k < BULLET_MASK_BITS; k++) {
+            int i = base + k;
+            pathX[k] = SDL_min(enemyBullets.x[i], enemyBullets.prev_x[i]);
+            pathY[k] = SDL_min(enemyBullets.y[i], enemyBullets.prev_y[i]);
+            pathW[k] = enemyBullets.w[i] + SDL_fabsf(enemyBullets.x[i] - enemyBullets.prev_x[i]);
+            pathH[k] = enemyBullets.h[i] + SDL_fabsf(enemyBullets.y[i] - enemyBullets.prev_y[i]);
+        }
+        hits &= testAABBs(playerPath, pathX, pathY, pathW, pathH, BULLET_MASK_BITS);
+
+        for (; hits; hits &= hits - 1) {
+            int i = base + std::countr_zero(hits);
+            float dx = (enemyBullets.x[i] - enemyBullets.prev_x[i]) - (playerTo.x - playerFrom.x);     //motion relative to the player
+            float dy = (enemyBullets.y[i] - enemyBullets.prev_y[i]) - (playerTo.y - playerFrom.y);
+            float time;
+            if (sweepAABB(enemyBullets.getPrevRect(i), dx, dy, playerFrom, time)) {
+                player->takeDamage(2);      //the player loses 2hp if the bullet strikes
+                enemyBullets.deactivate(i);
+            }
+        }
+    }
+}
+
+void World::handleGameOver() {        //the front end shows the game over menu when it sees this state
+    gameState->setGameOver(true);
+    gameState->setPaused(true);
+}
+
+void World::handleVictory() {         //same for the victory menu
+    gameState->setVictory(true);
+    gameState->setPaused(true);
+}
+
+const Entity& World::getPlayer() const {
+    return *player;
+}
+
+const EntityStore& World::getEntities() const {
+    return *entities;
+}
+
+const PlayerBulletManager& World::getPlayerBullets() const {
+    return *bulletManager;
+}
+
+const EnemyBulletManager& World::getEnemyBullets() const {
+    return *enemyBulletManager;
+}
+
+const EnemyManager& World::getEnemies() const {
+    return *enemyManager;
+}
+
+const GameState& World::getState() const {
+    return *gameState;
+}
+
+PlayBounds World::getBounds() const {
+    return bounds;
+}
+
+int World::getLevel() const {
+    return currentLevel;
+}
+
+Uint64 World::getTick() const {
+    return tick;
+}
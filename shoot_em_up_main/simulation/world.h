@@ -0,0 +1,110 @@
+#pragma once
+
+#include <SDL3/SDL_stdinc.h>
+#include <SDL3/SDL_rect.h>
+#include <string>
+#include <vector>
+#include "input.h"
+#include "entity.h"
+#include "entitystore.h"
+#include "collisiongrid.h"
+#include "aabbkernels.h"
+#include "bullet.h"
+#include "bulletkernels.h"
+#include "enemy.h"
+#include "gamestate.h"
+#include "random.h"
+
+// Play area as the simulation sees it
+struct PlayBounds {
+    int x;
+    int width;
+    int height;
+};
+
+// A change from outside the tick loop (menus, window), applied between two ticks and recorded in replays
+struct WorldCommand {
+    enum class Type : Uint8 { Reset, TogglePause, Resume, LoadLevel, Resize };
+    Type type;
+    int level;
+    PlayBounds bounds;
+};
+
+// Time spent in each part of step(), summed over the ticks since the last resetTimings()
+struct StepTimings {
+    Uint64 player_ns;       // movement and shooting
+    Uint64 bullets_ns;      // both bullet pools
+    Uint64 enemies_ns;      // spawning, movement and patrols
+    Uint64 collisions_ns;
+    Uint64 cleanup_ns;      // removing dead enemies, game over and victory checks
+};
+
+// The whole game simulation: player, bullets, enemies, collisions, score and state. It never touches
+// the window, the renderer or the keyboard, a front end feeds it one InputFrame per tick and reads it back.
+class World {
+private:
+    EntityStore* entities;
+    CollisionGrid* collisionGrid;
+    AABBBatch candidates;       // broad phase results of the current query
+    Entity* player;
+    PlayerBulletManager* bulletManager;
+    EnemyBulletManager* enemyBulletManager;
+    EnemyManager* enemyManager;
+    GameState* gameState;
+
+    PlayBounds bounds;
+    float initialPlayerX;
+    float initialPlayerY;
+    int currentLevel;
+    std::vector<std::string> levelOrder;
+    std::string levelFile;      // enemy file of the level being played, reloaded by reset()
+    Uint64 tick;
+    Uint64 seed;
+    Random random;              // the only randomness of the game, enemy fire picks its shooter here
+    bool timingEnabled;
+    StepTimings timings;
+
+    void lap(Uint64& phase, Uint64& mark) const;
+
+    void handleCollisions();
+    void buildCollisionGrid();
+    void checkBulletEnemyCollisions();
+    void checkPlayerEnemyCollisions();
+    void checkPlayerBulletCollisions();
+
+    void handleGameOver();
+    void handleVictory();
+
+public:
+    World(const PlayBounds& bounds);
+    ~World();
+
+    bool loadLevelOrder(const char* path = "levelOrder.txt");
+    std::string getLevelFilename(int level) const;
+    void loadLevel(int level);
+    void loadLevelFile(const std::string& filename);
+    void reset();
+
+    void step(const InputFrame& input, float dt);
+    void apply(const WorldCommand& command);
+    void setBounds(const PlayBounds& newBounds);
+    void togglePause();
+    void resume();
+
+    void setSeed(Uint64 value);      // restarts the random sequence, the sequence goes on through level loads
+    Uint64 getSeed() const;
+
+    void setTimingEnabled(bool enabled);       // off by default, timing costs a clock read per phase
+    void resetTimings();
+    const StepTimings& getTimings() const;
+
+    const Entity& getPlayer() const;
+    const EntityStore& getEntities() const;
+    const PlayerBulletManager& getPlayerBullets() const;
+    const EnemyBulletManager& getEnemyBullets() const;
+    const EnemyManager& getEnemies() const;
+    const GameState& getState() const;
+    PlayBounds getBounds() const;
+    int getLevel() const;
+    Uint64 getTick() const;
+};